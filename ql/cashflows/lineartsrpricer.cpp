@@ -27,6 +27,7 @@
 #include <ql/cashflows/lineartsrpricer.hpp>
 #include <ql/indexes/iborindex.hpp>
 #include <ql/instruments/vanillaswap.hpp>
+#include <ql/math/integrals/gaussianquadratures.hpp>
 #include <ql/math/integrals/kronrodintegral.hpp>
 #include <ql/math/solvers1d/brent.hpp>
 #include <ql/pricingengines/blackformula.hpp>
@@ -34,6 +35,7 @@
 #include <ql/termstructures/volatility/atmsmilesection.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/time/schedule.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -65,6 +67,75 @@ namespace QuantLib {
         if (integrator_ == nullptr)
             integrator_ =
                 ext::make_shared<GaussKronrodNonAdaptive>(1E-10, 5000, 1E-10);
+
+        if (settings_.replicationGrid_) {
+            QL_REQUIRE(settings_.gridPanels_ > 0,
+                       "at least one panel required for the replication grid");
+            QL_REQUIRE(settings_.gridNodes_ > 0,
+                       "at least one node per panel required for the "
+                       "replication grid");
+            GaussLegendreIntegration gaussLegendre(settings_.gridNodes_);
+            gridNodes_ = gaussLegendre.x();
+            gridWeights_ = gaussLegendre.weights();
+        }
+    }
+
+    LinearTsrPricer::ReplicationGrid::ReplicationGrid(
+        ext::shared_ptr<SmileSection> section,
+        Real forward,
+        Real lower,
+        Real upper,
+        Size panels,
+        const Array& nodes,
+        const Array& weights)
+    : section_(std::move(section)), forward_(forward), nodes_(nodes),
+      weights_(weights), edges_(2 * panels + 1), cumulative_(2 * panels + 1) {
+
+        // the panels are refined quadratically towards the forward, where
+        // the otm prices are largest and have a kink
+        edges_.front() = lower;
+        edges_[panels] = forward;
+        edges_.back() = upper;
+        for (Size m = 1; m < panels; ++m) {
+            Real u = static_cast<Real>(m) / static_cast<Real>(panels);
+            edges_[panels - m] = forward - (forward - lower) * u * u;
+            edges_[panels + m] = forward + (upper - forward) * u * u;
+        }
+
+        cumulative_.front() = 0.0;
+        for (Size i = 1; i < edges_.size(); ++i)
+            cumulative_[i] = cumulative_[i - 1] + panel(edges_[i - 1], edges_[i]);
+    }
+
+    Real LinearTsrPricer::ReplicationGrid::panel(Real a, Real b) const {
+        Real halfWidth = 0.5 * (b - a), midPoint = 0.5 * (a + b);
+        Real sum = 0.0;
+        for (Size i = 0; i < nodes_.size(); ++i) {
+            Real strike = midPoint + halfWidth * nodes_[i];
+            sum += weights_[i] *
+                   section_->optionPrice(strike, strike < forward_ ? Option::Put
+                                                                   : Option::Call);
+        }
+        return halfWidth * sum;
+    }
+
+    Real LinearTsrPricer::ReplicationGrid::primitive(Real x) const {
+        auto it = std::upper_bound(edges_.begin(), edges_.end(), x);
+        if (it == edges_.begin())
+            return 0.0;
+        if (it == edges_.end())
+            return cumulative_.back();
+        Size m = (it - edges_.begin()) - 1;
+        Real result = cumulative_[m];
+        if (x > edges_[m])
+            result += panel(edges_[m], x);
+        return result;
+    }
+
+    void LinearTsrPricer::update() {
+        replicationGrids_.clear();
+        replicationGrid_.reset();
+        CmsCouponPricer::update();
     }
 
     Real LinearTsrPricer::GsrG(const Date &d) const {
@@ -96,6 +167,14 @@ namespace QuantLib {
                                                               : Option::Call);
     }
 
+    Real LinearTsrPricer::integral(const Real lower, const Real upper) const {
+        if (replicationGrid_ != nullptr && replicationGrid_->covers(lower, upper))
+            return 2.0 * a_ *
+                   (replicationGrid_->primitive(upper) -
+                    replicationGrid_->primitive(lower));
+        return (*integrator_)(integrand_f(this), lower, upper);
+    }
+
     void LinearTsrPricer::initialize(const FloatingRateCoupon &coupon) {
 
         coupon_ = dynamic_cast<const CmsCoupon *>(&coupon);
@@ -188,6 +267,26 @@ namespace QuantLib {
 
             b_ = discountCurve_->discount(paymentDate_) / gy -
                  a_ * swapRateValue_;
+
+            // the grid only depends on the smile section, the forward and
+            // the bounds, so that it is shared by all coupons with the same
+            // fixing date and swap index
+            replicationGrid_.reset();
+            if (settings_.replicationGrid_ &&
+                adjustedLowerBound_ < swapRateValue_ &&
+                swapRateValue_ < adjustedUpperBound_) {
+                ext::shared_ptr<ReplicationGrid>& grid = replicationGrids_[
+                    std::make_pair(fixingDate_, swapIndex_->name())];
+                if (grid == nullptr ||
+                    !grid->matches(swapRateValue_, adjustedLowerBound_,
+                                   adjustedUpperBound_,
+                                   smileSection_->exerciseTime()))
+                    grid = ext::make_shared<ReplicationGrid>(
+                        smileSection_, swapRateValue_, adjustedLowerBound_,
+                        adjustedUpperBound_, settings_.gridPanels_,
+                        gridNodes_, gridWeights_);
+                replicationGrid_ = grid;
+            }
         }
     }
 
@@ -335,13 +434,11 @@ namespace QuantLib {
         if (upper > lower) {
             tmpBound = std::min(upper, swapRateValue_);
             if (tmpBound > lower) {
-                result += (*integrator_)(integrand_f(this),
-                                         lower, tmpBound);
+                result += integral(lower, tmpBound);
             }
             tmpBound = std::max(lower, swapRateValue_);
             if (upper > tmpBound) {
-                result += (*integrator_)(integrand_f(this),
-                                         tmpBound, upper);
+                result += integral(tmpBound, upper);
             }
             result *= (optionType == Option::Call ? 1.0 : -1.0);
         }
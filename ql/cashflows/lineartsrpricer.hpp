@@ -29,6 +29,8 @@
 #include <ql/instruments/payoffs.hpp>
 #include <ql/indexes/swapindex.hpp>
 #include <ql/math/integrals/integral.hpp>
+#include <ql/math/array.hpp>
+#include <map>
 
 namespace QuantLib {
 
@@ -58,6 +60,17 @@ namespace QuantLib {
         Note that for normal volatility input the lower rate bound
         is adjusted to min(-upperBound, lowerBound), except the bounds
         are set explicitly.
+
+        Optionally the replication integral can be computed on a
+        precomputed grid instead of the given integrator: for each
+        fixing date and swap index the smile section is sampled once
+        on composite Gauss-Legendre panels between the rate bounds
+        (clustered around the forward swap rate) and the running
+        integral of the out-of-the-money prices is stored. Every
+        coupon sharing the fixing date and the swap index (different
+        payment dates, caps, floors, spread legs using the same pricer)
+        then only needs the smile at the strike's partial panel. The
+        grids are discarded whenever the pricer is notified.
     */
 
     class LinearTsrPricer : public CmsCouponPricer, public MeanRevertingPricer {
@@ -141,6 +154,14 @@ namespace QuantLib {
                 return *this;
             }
 
+            Settings &withReplicationGrid(const Size panels = 24,
+                                          const Size nodesPerPanel = 8) {
+                replicationGrid_ = true;
+                gridPanels_ = panels;
+                gridNodes_ = nodesPerPanel;
+                return *this;
+            }
+
             enum Strategy {
                 RateBound,
                 VegaRatio,
@@ -154,6 +175,8 @@ namespace QuantLib {
             Real stdDevs_ = 3.0;
             Real lowerRateBound_, upperRateBound_;
             bool defaultBounds_ = true;
+            bool replicationGrid_ = false;
+            Size gridPanels_ = 24, gridNodes_ = 8;
         };
 
 
@@ -179,6 +202,8 @@ namespace QuantLib {
             registerWith(meanReversion_);
             update();
         }
+        /* */
+        void update() override;
 
 
       private:
@@ -186,8 +211,43 @@ namespace QuantLib {
         Real GsrG(const Date &d) const;
         Real singularTerms(Option::Type type, Real strike) const;
         Real integrand(Real strike) const;
+        Real integral(Real lower, Real upper) const;
         Real a_, b_;
 
+        /* running integral of the undiscounted out-of-the-money option
+           prices of a smile section on composite Gauss-Legendre panels */
+        class ReplicationGrid {
+          public:
+            ReplicationGrid(ext::shared_ptr<SmileSection> section,
+                            Real forward,
+                            Real lower,
+                            Real upper,
+                            Size panels,
+                            const Array& nodes,
+                            const Array& weights);
+            //! integral of the otm prices from the lower bound to x
+            Real primitive(Real x) const;
+            bool covers(Real a, Real b) const {
+                return a >= edges_.front() && b <= edges_.back();
+            }
+            bool matches(Real forward, Real lower, Real upper,
+                         Time exerciseTime) const {
+                return forward == forward_ && lower == edges_.front() &&
+                       upper == edges_.back() &&
+                       exerciseTime == section_->exerciseTime();
+            }
+          private:
+            Real panel(Real a, Real b) const;
+            ext::shared_ptr<SmileSection> section_;
+            Real forward_;
+            Array nodes_, weights_;
+            std::vector<Real> edges_, cumulative_;
+        };
+        ext::shared_ptr<ReplicationGrid> replicationGrid_;
+        std::map<std::pair<Date, std::string>,
+                         ext::shared_ptr<ReplicationGrid> > replicationGrids_;
+        Array gridNodes_, gridWeights_;
+
         class integrand_f;
         friend class integrand_f;
 
@@ -24,6 +24,18 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        struct SpreadGuard {
+            OneFactorModel::ShortRateTree* tree = nullptr;
+            ~SpreadGuard() {
+                if (tree != nullptr)
+                    tree->setSpread(0.0);
+            }
+        };
+
+    }
+
     TreeCallableFixedRateBondEngine::TreeCallableFixedRateBondEngine(
         const ext::shared_ptr<ShortRateModel>& model,
         const Size timeSteps,
@@ -67,14 +79,19 @@ namespace QuantLib {
         } else {
             std::vector<Time> times = callableBond.mandatoryTimes();
             TimeGrid timeGrid(times.begin(), times.end(), timeSteps_);
-            lattice = model_->tree(timeGrid);
+            lattice = model_->cachedTree(timeGrid);
         }
 
+        // the tree can be shared with other engines (see
+        // ShortRateModel::cachedTree) so the spread is removed again
+        // when leaving this scope
+        SpreadGuard guard;
         if (s != 0.0) {
             auto* sr = dynamic_cast<OneFactorModel::ShortRateTree*>(&(*lattice));
             QL_REQUIRE(sr,
                        "Spread is not supported for trees other than OneFactorModel");
             sr->setSpread(s);
+            guard.tree = sr;
         }
 
         Time redemptionTime =
@@ -88,5 +105,24 @@ namespace QuantLib {
         results_.settlementValue = results_.value / d;
     }
 
+    TimeGrid TreeCallableFixedRateBondEngine::unionTimeGrid(
+                    const std::vector<ext::shared_ptr<CallableBond> >& bonds,
+                    const Date& referenceDate,
+                    const DayCounter& dayCounter,
+                    Size timeSteps) {
+        std::vector<Time> times;
+        for (const auto& b : bonds) {
+            CallableBond::arguments arguments;
+            // setupArguments is only public in the Instrument interface
+            const Instrument& instrument = *b;
+            instrument.setupArguments(&arguments);
+            DiscretizedCallableFixedRateBond bond(arguments, referenceDate,
+                                                  dayCounter);
+            std::vector<Time> t = bond.mandatoryTimes();
+            times.insert(times.end(), t.begin(), t.end());
+        }
+        return TimeGrid(times.begin(), times.end(), timeSteps);
+    }
+
 }
 
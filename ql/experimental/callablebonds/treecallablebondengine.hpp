@@ -51,6 +51,18 @@ namespace QuantLib {
         //@}
         void calculate() const override;
 
+        //! time grid including the mandatory times of all the bonds
+        /*! An engine built on this grid prices all of the given bonds
+            on the same tree, which is fitted only once.  The reference
+            date and day counter must be those of the term structure
+            used by the engine.
+        */
+        static TimeGrid unionTimeGrid(
+            const std::vector<ext::shared_ptr<CallableBond> >& bonds,
+            const Date& referenceDate,
+            const DayCounter& dayCounter,
+            Size timeSteps);
+
       private:
         void calculateWithSpread(Spread s) const;
         Handle<YieldTermStructure> termStructure_;
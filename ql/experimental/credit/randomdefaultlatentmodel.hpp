@@ -29,6 +29,7 @@
 #include <ql/experimental/math/tcopulapolicy.hpp>
 #include <ql/math/beta.hpp>
 #include <ql/math/functional.hpp>
+#include <ql/math/matrix.hpp>
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/solvers1d/brent.hpp>
@@ -74,10 +75,18 @@ namespace QuantLib {
     Generates the factors and variable samples and determines event threshold
     but it is not responsible for actual event specification; thats the derived
     classes responsibility according to what they model.
-    Derived classes need mainly to implement nextSample (Worker::nextSample in
-    the multithreaded version) to compute the simulation event generated, if
-    any, from the latent variables sample. They also have the accompanying
-    event trait to specify.
+    Derived classes need mainly to implement nextSample to compute the
+    simulation events generated, if any, from the latent variables sample and
+    store them into the buffer passed. They also have the accompanying event
+    trait to specify.
+
+    When OpenMP is enabled, samples are drawn sequentially in blocks and the
+    events of each block are computed in parallel, each simulation writing
+    into its own buffer; the statistics are also computed in parallel over
+    the simulations. Since the sequence of samples does not depend on the
+    number of threads, neither do the results. nextSample must therefore be
+    safe to call concurrently; lazy term structures are bootstrapped in
+    initDates before the simulation starts.
     */
     /* CRTP used for performance to avoid virtual table resolution in the Monte
     Carlo. Not only in sample generation but access; quite an amount of time can
@@ -88,8 +97,6 @@ namespace QuantLib {
     \todo: someone with sound experience on cache misses look into this, the
     statistics will be getting memory in and out of the cpu heavily and it
     might be possible to get performance out of that.
-    \todo: parallelize the statistics computation, things like Var/ESF splits
-    are very expensive.
     \todo: consider another design, taking the statistics outside the models.
     */
     template<template <class, class> class derivedRandomLM, class copulaPolicy,
@@ -122,25 +129,57 @@ namespace QuantLib {
         }
 
         void performSimulations() const {
-            // Next sequence should determine the event and push it into buffer
-            for (Size i = nSims_; i != 0U; i--) {
-                const std::vector<Real>& sample =
-                    copulasRng_->nextSequence().value;
-                static_cast<const derivedRandomLM<copulaPolicy, USNG>* >(
-                    this)->nextSample(sample);
-            // alternatively make call an explicit local method...
+            typedef derivedRandomLM<copulaPolicy, USNG> derived_type;
+            const derived_type* derived =
+                static_cast<const derived_type*>(this);
+
+            simsBuffer_.clear();
+            simsBuffer_.resize(nSims_);
+
+            const Size blockSize = simulationBlock_;
+            std::vector<std::vector<Real> > samples;
+            for (Size first = 0; first < nSims_; first += blockSize) {
+                const Size last = std::min(first + blockSize, nSims_);
+                // the generator is sequential; drawing the samples here
+                // keeps the results independent of the number of threads
+                samples.resize(last - first);
+                for (Size i = first; i < last; i++)
+                    samples[i - first] = copulasRng_->nextSequence().value;
+
+                // Next sample determines the events and stores them
+                std::string error;
+                #pragma omp parallel for
+                for (long i = static_cast<long>(first);
+                     i < static_cast<long>(last); i++) {
+                    try {
+                        derived->nextSample(samples[i - first],
+                                            simsBuffer_[i]);
+                    } catch (std::exception& e) {
+                        #pragma omp critical
+                        {
+                            if (error.empty())
+                                error = e.what();
+                        }
+                    }
+                }
+                QL_REQUIRE(error.empty(), error);
             }
         }
 
         /* Method to access simulation results and avoiding a copy of
-        each thread results buffer. PerformCalculations should have been called.
-        Here in the monothread version this method is redundant/trivial but
-        serves to detach the statistics access to the way the simulations are
-        stored.
+        the results buffer. PerformCalculations should have been called.
+        It serves to detach the statistics access to the way the simulations
+        are stored.
         */
         const std::vector<simEvent<derivedRandomLM<copulaPolicy, USNG> > >&
             getSim(const Size iSim) const { return simsBuffer_[iSim]; }
 
+        /* Tranche loss of each simulation, counting the events taking place
+        strictly before the given number of days from today. Computed in
+        parallel over the simulations. */
+        Disposable<std::vector<Real> > simulatedTrancheLosses(
+            Date::serial_type val) const;
+
         /* Allows statistics to be written generically for fixed and random
         recovery rates. */
         Real getEventRecovery(
@@ -219,12 +258,59 @@ namespace QuantLib {
 
         // Maximum time inversion horizon
         static const Size maxHorizon_ = 4050; // over 11 years
+        // Number of samples drawn before their events are computed
+        static const Size simulationBlock_ = 1024;
         // Inversion probability limits are computed by children in initdates()
     };
 
 
     /* ---- Statistics ---------------------------------------------------  */
 
+    template<template <class, class> class D, class C, class URNG>
+    Disposable<std::vector<Real> >
+        RandomLM<D, C, URNG>::simulatedTrancheLosses(
+            Date::serial_type val) const
+    {
+        const Date today = Settings::instance().evaluationDate();
+
+        Real attachAmount = basket_->attachmentAmount();
+        Real detachAmount = basket_->detachmentAmount();
+
+        std::vector<Real> losses(nSims_);
+        std::string error;
+        #pragma omp parallel for
+        for(long iSim=0; iSim < static_cast<long>(nSims_); iSim++) {
+            try {
+                const std::vector<simEvent<D<C, URNG> > >& events =
+                    getSim(iSim);
+                Real portfSimLoss=0.;
+                for(Size iEvt=0; iEvt < events.size(); iEvt++) {
+                    // if event is within time horizon...
+                    if(val > static_cast<Date::serial_type>(
+                           events[iEvt].dayFromRef)) {
+                        Size iName = events[iEvt].nameIdx;
+                        portfSimLoss +=
+                            basket_->exposure(basket_->names()[iName],
+                                Date(events[iEvt].dayFromRef +
+                                    today.serialNumber())) *
+                                        (1.-getEventRecovery(events[iEvt]));
+                    }
+                }
+                losses[iSim] =
+                    std::min(std::max(portfSimLoss - attachAmount, 0.),
+                             detachAmount - attachAmount);
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+        }
+        QL_REQUIRE(error.empty(), error);
+        return losses;
+    }
+
     template<template <class, class> class D, class C, class URNG>
     Probability RandomLM<D, C, URNG>::probAtLeastNEvents(Size n,
         const Date& d) const
@@ -238,8 +324,9 @@ namespace QuantLib {
 
         if(n==0) return 1.;
 
-        Real counts = 0.;
-        for(Size iSim=0; iSim < nSims_; iSim++) {
+        long counts = 0;
+        #pragma omp parallel for reduction(+:counts)
+        for(long iSim=0; iSim < static_cast<long>(nSims_); iSim++) {
             Size simCount = 0;
             const std::vector<simEvent<D<C, URNG> > >& events =
                 getSim(iSim);
@@ -248,7 +335,7 @@ namespace QuantLib {
                 if(val > events[iEvt].dayFromRef) simCount++;
             if(simCount >= n) counts++;
         }
-        return counts/nSims_;
+        return Real(counts)/nSims_;
         // \todo Provide confidence interval
     }
 
@@ -267,8 +354,9 @@ namespace QuantLib {
         // casted to natural to avoid warning, we have just checked the sign
         Natural val = d.serialNumber() - today.serialNumber();
 
-        std::vector<Probability> hitsByDate(basketSize, 0.);
-        for(Size iSim=0; iSim < nSims_; iSim++) {
+        std::vector<Size> hits(basketSize, 0);
+        #pragma omp parallel for
+        for(long iSim=0; iSim < static_cast<long>(nSims_); iSim++) {
             const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
             std::map<unsigned short, unsigned short> namesDefaulting;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
@@ -285,12 +373,13 @@ namespace QuantLib {
                 // locate nth default in time:
                 std::advance(itdefs, n-1);
                 // update statistic:
-                hitsByDate[itdefs->second]++;
+                #pragma omp atomic
+                hits[itdefs->second]++;
             }
         }
-        std::transform(hitsByDate.begin(), hitsByDate.end(),
-                       hitsByDate.begin(),
-                       divide_by<Real>(Real(nSims_)));
+        std::vector<Probability> hitsByDate(basketSize);
+        for(Size i=0; i < basketSize; i++)
+            hitsByDate[i] = Real(hits[i]) / Real(nSims_);
         return hitsByDate;
         // \todo Provide confidence interval
     }
@@ -313,7 +402,10 @@ namespace QuantLib {
         //   would distort the simulation results.
         Real expectedDefi = 0.;
         Real expectedDefj = 0.;
-        for(Size iSim=0; iSim < nSims_; iSim++) {
+        // sums of zeros and ones, exact in any order
+        #pragma omp parallel for \
+            reduction(+:expectedDefiDefj,expectedDefi,expectedDefj)
+        for(long iSim=0; iSim < static_cast<long>(nSims_); iSim++) {
             const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
             Real imatch = 0., jmatch = 0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
@@ -352,32 +444,12 @@ namespace QuantLib {
         Date today = Settings::instance().evaluationDate();
         Date::serial_type val = d.serialNumber() - today.serialNumber();
 
-        Real attachAmount = basket_->attachmentAmount();
-        Real detachAmount = basket_->detachmentAmount();
+        const std::vector<Real> losses = simulatedTrancheLosses(val);
 
         // Real trancheLoss= 0.;
         GeneralStatistics lossStats;
-        for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
-
-            Real portfSimLoss=0.;
-            for(Size iEvt=0; iEvt < events.size(); iEvt++) {
-                // if event is within time horizon...
-                if(val > static_cast<Date::serial_type>(
-					   events[iEvt].dayFromRef)) {
-                    Size iName = events[iEvt].nameIdx;
-                    // ...and is contained in the basket.
-                        portfSimLoss +=
-                            basket_->exposure(basket_->names()[iName],
-                                Date(events[iEvt].dayFromRef +
-                                    today.serialNumber())) *
-                                        (1.-getEventRecovery(events[iEvt]));
-               }
-            }
-            lossStats.add(// d  ates? current losses? realized defaults, not yet
-                std::min(std::max(portfSimLoss - attachAmount, 0.),
-                    detachAmount - attachAmount) );
-        }
+        for(Size iSim=0; iSim < nSims_; iSim++)
+            lossStats.add(losses[iSim]);
         return std::make_pair(lossStats.mean(), lossStats.errorEstimate() *
             InverseCumulativeNormal::standard_value(0.5*(1.+confidencePerc)));
     }
@@ -413,30 +485,8 @@ namespace QuantLib {
             "Requested percentile date must lie after computation date.");
         calculate();
 
-        Real attachAmount = basket_->attachmentAmount();
-        Real detachAmount = basket_->detachmentAmount();
-
-        for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
-
-            Real portfSimLoss=0.;
-            for(Size iEvt=0; iEvt < events.size(); iEvt++) {
-                if(val > static_cast<Date::serial_type>(
-					 events[iEvt].dayFromRef)) {
-                    Size iName = events[iEvt].nameIdx;
-          // test needed (here and the others) to reuse simulations:
-          //          if(basket_->pool()->has(copula_->pool()->names()[iName]))
-                        portfSimLoss +=
-                            basket_->exposure(basket_->names()[iName],
-                                Date(events[iEvt].dayFromRef +
-                                    today.serialNumber())) *
-                                        (1.-getEventRecovery(events[iEvt]));
-                }
-            }
-            data.push_back(std::min(std::max(portfSimLoss - attachAmount, 0.),
-                detachAmount - attachAmount));
-            keys.insert(data.back());
-        }
+        data = simulatedTrancheLosses(val);
+        keys.insert(data.begin(), data.end());
         // avoid using as many points as in the simulation.
         Size nPts = std::min<Size>(data.size(), 150);// fix
         return Histogram(data.begin(), data.end(), nPts);
@@ -452,34 +502,11 @@ namespace QuantLib {
             "Requested percentile date must lie after computation date.");
         calculate();
 
-        Real attachAmount = basket_->attachmentAmount();
-        Real detachAmount = basket_->detachmentAmount();
-
         Date::serial_type val = d.serialNumber() - today.serialNumber();
         if(val <= 0) return 0.;// plus basket realized losses
 
         //GenericRiskStatistics<GeneralStatistics> statsX;
-        std::vector<Real> losses;
-        for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
-            Real portfSimLoss=0.;
-            for(Size iEvt=0; iEvt < events.size(); iEvt++) {
-                if(val > static_cast<Date::serial_type>(
-					  events[iEvt].dayFromRef)) {
-                    Size iName = events[iEvt].nameIdx;
-                    // ...and is contained in the basket.
-                    //if(basket_->pool()->has(copula_->pool()->names()[iName]))
-                        portfSimLoss +=
-                            basket_->exposure(basket_->names()[iName],
-                                Date(events[iEvt].dayFromRef +
-                                    today.serialNumber())) *
-                                        (1.-getEventRecovery(events[iEvt]));
-                }
-            }
-            portfSimLoss = std::min(std::max(portfSimLoss - attachAmount, 0.),
-                detachAmount - attachAmount);
-            losses.push_back(portfSimLoss);
-        }
+        std::vector<Real> losses = simulatedTrancheLosses(val);
 
         std::sort(losses.begin(), losses.end());
         Real posit = std::ceil(percent * nSims_);
@@ -547,32 +574,10 @@ namespace QuantLib {
             "Incorrect percentile");
         calculate();
 
-        Real attachAmount = basket_->attachmentAmount();
-        Real detachAmount = basket_->detachmentAmount();
-
-        std::vector<Real> rankLosses;
         Date today = Settings::instance().evaluationDate();
         Date::serial_type val = d.serialNumber() - today.serialNumber();
-        for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
-            Real portfSimLoss=0.;
-            for(Size iEvt=0; iEvt < events.size(); iEvt++) {
-                if(val > static_cast<Date::serial_type>(
-					 events[iEvt].dayFromRef)) {
-                    Size iName = events[iEvt].nameIdx;
-                 //   if(basket_->pool()->has(copula_->pool()->names()[iName]))
-                        portfSimLoss +=
-                            basket_->exposure(basket_->names()[iName],
-                                Date(events[iEvt].dayFromRef +
-                                    today.serialNumber())) *
-                                        (1.-getEventRecovery(events[iEvt]));
-                }
-            }
-            portfSimLoss = std::min(std::max(portfSimLoss - attachAmount, 0.),
-                detachAmount - attachAmount);
-            // update dataset for rank stat:
-            rankLosses.push_back(portfSimLoss);
-        }
+        // dataset for rank stat:
+        std::vector<Real> rankLosses = simulatedTrancheLosses(val);
 
         std::sort(rankLosses.begin(), rankLosses.end());
         Size quantilePosition = static_cast<Size>(floor(nSims_*percentile));
@@ -634,7 +639,6 @@ namespace QuantLib {
     }
 
 
-    // parallelize this one(if possible), it is really expensive
     template<template <class, class> class D, class C, class URNG>
     /* FIX ME: some trouble on limit cases, like zero loss or no losses over the
     requested level.*/
@@ -650,42 +654,37 @@ namespace QuantLib {
         Real detachAmount = basket_->detachmentAmount();
         Size numLiveNames = basket_->remainingSize();
 
-        std::vector<Real> split(numLiveNames, 0.);
         std::vector<GeneralStatistics> splitStats(numLiveNames,
             GeneralStatistics());
         Date today = Settings::instance().evaluationDate();
         Date::serial_type val = date.serialNumber() - today.serialNumber();
 
-        for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
-            Real portfSimLoss=0.;
-            //std::vector<Real> splitBuffer(numLiveNames_, 0.);
-            std::vector<simEvent<D<C, URNG> > > splitEventsBuffer;
-
-            for(Size iEvt=0; iEvt < events.size(); iEvt++) {
-                if(val > static_cast<Date::serial_type>(
-					 events[iEvt].dayFromRef)) {
-                    Size iName = events[iEvt].nameIdx;
-                // if(basket_->pool()->has(copula_->pool()->names()[iName])) {
-                        portfSimLoss +=
-                            basket_->exposure(basket_->names()[iName],
-                                Date(events[iEvt].dayFromRef +
-                                    today.serialNumber())) *
-                                        (1.-getEventRecovery(events[iEvt]));
-                        //and will sort later if buffer applies:
+        /* first pass; split is conditional to total losses within target
+        losses/percentile:  */
+        const std::vector<Real> portfLosses = simulatedTrancheLosses(val);
+        std::vector<Size> tailSims;
+        for(Size iSim=0; iSim < nSims_; iSim++)
+            if(portfLosses[iSim] > loss) tailSims.push_back(iSim);
+
+        // second pass; splits are computed in parallel...
+        Matrix splits(tailSims.size(), numLiveNames, 0.);
+        std::vector<Real> ptflTrancheLosses(tailSims.size());
+        std::string error;
+        #pragma omp parallel for
+        for(long iTail=0; iTail < static_cast<long>(tailSims.size());
+            iTail++) {
+            try {
+                const std::vector<simEvent<D<C, URNG> > >& events =
+                    getSim(tailSims[iTail]);
+                std::vector<simEvent<D<C, URNG> > > splitEventsBuffer;
+                for(Size iEvt=0; iEvt < events.size(); iEvt++) {
+                    if(val > static_cast<Date::serial_type>(
+                         events[iEvt].dayFromRef))
                         splitEventsBuffer.push_back(events[iEvt]);
                 }
-            }
-            portfSimLoss = std::min(std::max(portfSimLoss - attachAmount, 0.),
-                detachAmount - attachAmount);
-
-            /* second pass; split is conditional to total losses within target
-            losses/percentile:  */
-            Real ptflCumulLoss = 0.;
-            if(portfSimLoss > loss) {
                 std::sort(splitEventsBuffer.begin(), splitEventsBuffer.end());
-                //NOW THIS:
-                split.assign(numLiveNames, 0.);
+
+                Real ptflCumulLoss = 0.;
                 /*  if the name triggered a loss in the portf limits assign
                 this loss to that name..  */
                 for(Size i=0; i<splitEventsBuffer.size(); i++) {
@@ -707,15 +706,29 @@ namespace QuantLib {
                         std::min(std::max(ptflCumulLoss - attachAmount, 0.),
                         detachAmount - attachAmount);
                     // assign new losses:
-                    split[iName] += tranchedLossAfter - tranchedLossBefore;
+                    splits[iTail][iName] +=
+                        tranchedLossAfter - tranchedLossBefore;
                 }
-                for(Size iName=0; iName<numLiveNames; iName++) {
-                    splitStats[iName].add(split[iName] /
-                        std::min(std::max(ptflCumulLoss - attachAmount, 0.),
-                            detachAmount - attachAmount) );
+                ptflTrancheLosses[iTail] =
+                    std::min(std::max(ptflCumulLoss - attachAmount, 0.),
+                             detachAmount - attachAmount);
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
                 }
             }
         }
+        QL_REQUIRE(error.empty(), error);
+
+        // ...and accumulated in simulation order
+        for(Size iTail=0; iTail < tailSims.size(); iTail++) {
+            for(Size iName=0; iName<numLiveNames; iName++) {
+                splitStats[iName].add(splits[iTail][iName] /
+                    ptflTrancheLosses[iTail]);
+            }
+        }
 
         // Compute error in VaR split
         std::vector<Real> means, rangeUp, rangeDown;
@@ -865,7 +878,8 @@ namespace QuantLib {
         */
         friend class RandomLM< ::QuantLib::RandomDefaultLM, copulaPolicy, USNG>;
     protected:
-        void nextSample(const std::vector<Real>& values) const;
+        void nextSample(const std::vector<Real>& values,
+                        std::vector<defaultSimEvent>& events) const;
         void initDates() const {
             /* Precalculate horizon time default probabilities (used to
               determine if the default took place and subsequently compute its
@@ -924,11 +938,12 @@ namespace QuantLib {
 
     template<class C, class URNG>
     void RandomDefaultLM<C, URNG>::nextSample(
-        const std::vector<Real>& values) const
+        const std::vector<Real>& values,
+        std::vector<defaultSimEvent>& events) const
     {
         const ext::shared_ptr<Pool>& pool = this->basket_->pool();
         // starts with no events
-        this->simsBuffer_.push_back(std::vector<defaultSimEvent> ());
+        events.clear();
 
         for(Size iName=0; iName<model_->size(); iName++) {
             Real latentVarSample =
@@ -956,8 +971,7 @@ namespace QuantLib {
                                         std::log(1.-simDefaultProb)
                     /std::log(1.-data_.horizonDefaultPs_[iName])));
                    */
-                this->simsBuffer_.back().push_back(defaultSimEvent(iName,
-                    dateSTride));
+                events.push_back(defaultSimEvent(iName, dateSTride));
                //emplace_back
             }
         /* Used to remove sims with no events. Uses less memory, faster
@@ -101,7 +101,8 @@ namespace QuantLib {
         */
         friend class RandomLM< ::QuantLib::RandomLossLM, copulaPolicy, USNG>;
     protected:
-        void nextSample(const std::vector<Real>& values) const;
+        void nextSample(const std::vector<Real>& values,
+                        std::vector<defaultSimEvent>& events) const;
 
         // see note on randomdefaultlatentmodel
         void initDates() const {
@@ -155,10 +156,11 @@ namespace QuantLib {
 
     template<class C, class URNG>
     void RandomLossLM<C, URNG>::nextSample(
-        const std::vector<Real>& values) const 
+        const std::vector<Real>& values,
+        std::vector<defaultSimEvent>& events) const
     {
         const ext::shared_ptr<Pool>& pool = this->basket_->pool();
-        this->simsBuffer_.push_back(std::vector<defaultSimEvent> ());
+        events.clear();
 
         // half the model is defaults, the other half are RRs...
         for(Size iName=0; iName<copula_->size()/2; iName++) {
@@ -212,7 +214,7 @@ namespace QuantLib {
                 Real recovery = 
                     copula_->conditionalRecovery(latentRRVarSample,
                         iName, eventDate);
-                this->simsBuffer_.back().push_back(
+                events.push_back(
                   defaultSimEvent(iName, dateSTride, recovery));
                 //emplace_back
             }
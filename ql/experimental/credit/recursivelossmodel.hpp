@@ -40,8 +40,6 @@ namespace QuantLib {
         portfolio loss weights (notionals and recoveries). As it is now this
         is ok for pricing but not for risk metrics. See the discussion in O'Kane
         18.3.2
-        \todo Intengrands should all use the inverted probabilities for 
-        performance instead of calling the copula inversion with the same vals.
     */
     template<class copulaPolicy> 
     class RecursiveLossModel : public DefaultLossModel {
@@ -53,28 +51,33 @@ namespace QuantLib {
       : copula_(m), nBuckets_(nbuckets) {}
 
     private:
+      /*! Conditional loss density on the loss unit grid. Entry \f$ k \f$
+          holds the probability of a portfolio loss of \f$ k \f$ loss units;
+          the recursion of eq. 10 p.68 is run in place on a dense buffer
+          sized at reset time, so no node-dependent allocation or lookup is
+          needed. Only the entries flagged in attainable_ are meaningful.
+      @param pDef Conditional default probabilities of each live name.
+      */
+      void conditionalLossDensity(const std::vector<Probability>& pDef,
+                                  std::vector<Probability>& density) const;
       /*!
-      @param pDefDate Vector of unconditional default probabilities for each
-      live name (at the current evaluation date). This is passed instead of
-      the date for performance reasons (if in the future other magnitudes
-      -e.g. lgd- are contingent on the date they shouldd be passed too).
+      @param invPDefDate Vector of inverted unconditional default
+      probabilities for each live name (at the current evaluation date).
+      This is passed instead of the date for performance reasons (if in the
+      future other magnitudes -e.g. lgd- are contingent on the date they
+      should be passed too).
       */
-      Disposable<std::map<Real, Probability> >
-      conditionalLossDistrib(const std::vector<Probability>& pDefDate,
-                             const std::vector<Real>& mktFactor) const;
-      Real expectedConditionalLoss(const std::vector<Probability>& pDefDate, //<< never used!!
-                                   const std::vector<Real>& mktFactor) const;
-      Disposable<std::vector<Real> > conditionalLossProb(const std::vector<Probability>& pDefDate,
-                                                         // const Date& date,
-                                                         const std::vector<Real>& mktFactor) const;
-      // versions using the P-inverse, deprecate the former
-      Disposable<std::map<Real, Probability> >
-      conditionalLossDistribInvP(const std::vector<Real>& pDefDate,
-                                 // const Date& date,
-                                 const std::vector<Real>& mktFactor) const;
-      Real expectedConditionalLossInvP(const std::vector<Real>& pDefDate,
-                                       // const Date& date,
+      Real expectedConditionalLossInvP(const std::vector<Real>& invPDefDate,
                                        const std::vector<Real>& mktFactor) const;
+      /*! Conditional probabilities of the attainable losses, in increasing
+          loss order. Names whose unconditional probability is negligible
+          (flagged in \p negligible) are taken not to default, as in
+          DefaultLatentModel::conditionalDefaultProbability.
+      */
+      Disposable<std::vector<Real> > conditionalLossProbInvP(
+                                  const std::vector<Real>& invPDefDate,
+                                  const std::vector<bool>& negligible,
+                                  const std::vector<Real>& mktFactor) const;
     protected:
       void resetModel() override;
 
@@ -109,7 +112,9 @@ namespace QuantLib {
     private:
         // loss model descriptor members
         const Size nBuckets_;
-        mutable std::vector<Real> wk_;
+        mutable std::vector<Size> wk_;
+        //! flags the loss units attainable by some subset of defaults
+        mutable std::vector<bool> attainable_;
         mutable Real lossUnit_;
         //! name to name factor. In the single factor copula:
         //    correl = beta * beta
@@ -180,11 +185,22 @@ namespace QuantLib {
     inline Disposable<std::vector<Real> > 
     RecursiveLossModel<CP>::lossProbability(const Date& date) const {
 
+        // invert the unconditional probabilities once per date rather than
+        //   once per name at each integration node
         std::vector<Probability> uncDefProb = 
             basket_->remainingProbabilities(date);
+        std::vector<Real> invProb(uncDefProb.size(), 0.);
+        std::vector<bool> negligible(uncDefProb.size(), false);
+        for(Size i=0; i<uncDefProb.size(); ++i) {
+            // same threshold as DefaultLatentModel, avoids inverting ~0
+            if(uncDefProb[i] < 1.e-10)
+                negligible[i] = true;
+            else
+                invProb[i] = copula_->inverseCumulativeY(uncDefProb[i], i);
+        }
         return copula_->integratedExpectedValueV(
             [&](const std::vector<Real>& v1) {
-                return conditionalLossProb(uncDefProb, v1);
+                return conditionalLossProbInvP(invProb, negligible, v1);
             });
     }
 
@@ -210,8 +226,24 @@ namespace QuantLib {
         lgds.erase(std::remove(lgds.begin(), lgds.end(), 0.), lgds.end());
         lossUnit_ = *(std::min_element(lgds.begin(), lgds.end()))
             / nBuckets_;
-        for(Size i=0; i<remainingBsktSize_; ++i)
-            wk_.push_back(std::floor(lgdsTmp[i]/lossUnit_ + .5));
+        wk_.clear();
+        Size maxUnits = 0;
+        for(Size i=0; i<remainingBsktSize_; ++i) {
+            wk_.push_back(static_cast<Size>(
+                std::floor(lgdsTmp[i]/lossUnit_ + .5)));
+            maxUnits += wk_.back();
+        }
+        // subset sums of the loss weights; these are the keys the loss
+        //   distribution is reported on.
+        attainable_.assign(maxUnits + 1, false);
+        attainable_[0] = true;
+        Size top = 0;
+        for(Size i=0; i<remainingBsktSize_; ++i) {
+            for(Size k=top+1; k-- > 0; )
+                if(attainable_[k])
+                    attainable_[k + wk_[i]] = true;
+            top += wk_[i];
+        }
     }
 
     // make it return a distribution object?
@@ -303,104 +335,30 @@ namespace QuantLib {
     }
 
     template<class CP>
-    Disposable<std::map<Real, Probability> >
-        RecursiveLossModel<CP>::conditionalLossDistrib(
-            const std::vector<Probability>& pDefDate, 
-            //const Date& date,
-            const std::vector<Real>& mktFactor) const 
-    {
-        //eq. 10 p.68
-        //attainable losses distribution, recursive algorithm
-        const std::vector<Probability>& uncDefProb = pDefDate;// alias, remove
-
-        std::map<Real, Probability> pIndepDistrib;
-        ////////  K=0
-        pIndepDistrib.insert(std::make_pair(0., 1.));
-        for(Size iName=0; iName<remainingBsktSize_; ++iName) {
-            Probability pDef =
-                copula_->conditionalDefaultProbability(uncDefProb[iName], iName,
-                                                mktFactor);
-            ////// iterate on all possible losses in the distribution:
-            std::map<Real, Probability> pDistTemp;
-            auto distIt = pIndepDistrib.begin();
-            while(distIt != pIndepDistrib.end()) {
-              ///   update prob if this name does not default
-              auto matchIt = pDistTemp.find(distIt->first);
-              if (matchIt != pDistTemp.end()) {
-                  matchIt->second += distIt->second * (1. - pDef);
-                }else{
-                    pDistTemp.insert(std::make_pair(distIt->first,
-                        distIt->second * (1.-pDef)));
-                }
-              ////   and if it does
-                matchIt = pDistTemp.find(distIt->first + wk_[iName]);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * pDef;
-                }else{
-                    pDistTemp.insert(std::make_pair(
-                        distIt->first+wk_[iName], distIt->second * pDef));
-                }
-                ++distIt;
-            }
-           /////  copy back
-            pIndepDistrib = pDistTemp;
-        }
-        /* Apply tranche limits now .... mind you this could be done outside*/
-        ////  to be done....
-        return pIndepDistrib;
-    }
-
-    template<class CP>
-    Disposable<std::map<Real, Probability> >
-        // twice?! rewrite one in terms of the other, this is a duplicate!
-        RecursiveLossModel<CP>::conditionalLossDistribInvP(
-            const std::vector<Real>& invpDefDate, 
-            //const Date& date,
-            const std::vector<Real>& mktFactor) const 
+    void RecursiveLossModel<CP>::conditionalLossDensity(
+        const std::vector<Probability>& pDef,
+        std::vector<Probability>& density) const
     {
         // eq. 10 p.68
         // attainable losses distribution, recursive algorithm
-
-        std::map<Real, Probability> pIndepDistrib;
+        density.assign(attainable_.size(), 0.);
         // K=0
-        pIndepDistrib.insert(std::make_pair(0., 1.));
+        density[0] = 1.;
+        Size top = 0;
         for(Size iName=0; iName<remainingBsktSize_; ++iName) {
-            Probability pDef =
-                copula_->conditionalDefaultProbabilityInvP(invpDefDate[iName], 
-                    iName, mktFactor);
-
-            // iterate on all possible losses in the distribution:
-            std::map<Real, Probability> pDistTemp;
-            auto distIt = pIndepDistrib.begin();
-            while(distIt != pIndepDistrib.end()) {
-                // update prob if this name does not default
-                auto matchIt = pDistTemp.find(distIt->first);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * (1.-pDef);
-                }else{
-                    pDistTemp.insert(std::make_pair(distIt->first,
-                        distIt->second * (1.-pDef)));
-                }
-                // and if it does
-                matchIt = pDistTemp.find(distIt->first + wk_[iName]);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * pDef;
-                }else{
-                    pDistTemp.insert(std::make_pair(
-                        distIt->first+wk_[iName], distIt->second * pDef));
-                }
-                ++distIt;
-            }
-            // copy back
-            pIndepDistrib = pDistTemp;
+            const Size w = wk_[iName];
+            const Probability p = pDef[iName];
+            top += w;
+            // backwards, so that density[k-w] still holds the previous
+            //   name's value when it is read
+            for(Size k=top+1; k-- > w; )
+                density[k] = density[k] * (1.-p) + density[k-w] * p;
+            for(Size k=w; k-- > 0; )
+                density[k] *= (1.-p);
         }
         /* Apply tranche limits now .... mind you this could be done outside*/
-        return pIndepDistrib;
     }
 
-
-
-
     /*
     Bugs here???. The max min on the tranche looks 
     wrong. It is better to have a tranche function since that way we can avoid 
@@ -409,89 +367,51 @@ namespace QuantLib {
     */
     //! Portfolio loss conditional to the market factor value
     template<class CP>
-    Real RecursiveLossModel<CP>::expectedConditionalLoss(
-        const std::vector<Probability>& pDefDate, 
-        //const Date& date,
-        const std::vector<Real>& mktFactor) const 
-    {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistrib(pDefDate, mktFactor);
-
-        // get the expected value subject to the value of the market
-        //   factor.
-        Real expLoss = 0.;
-        //---------------------------------------------------------------
-        /* This is the original (easy to read) loop which I have partially
-             unroll below to take profit of the fact that once we go over
-             the tranche top the loss amount is fixed:
-        */
-        auto distIt = pIndepDistrib.begin();
-
-        while(distIt != pIndepDistrib.end()) {
-            Real loss = distIt->first * lossUnit_;
-     //       loss = std::max(std::min(loss, detachAmount_)-attachAmount_, 0.);
-            loss = std::min(std::max(loss - attachAmount_, 0.), 
-                detachAmount_ - attachAmount_);
-            // MIN MAX BUGS ....??
-            expLoss += loss * distIt->second;
-            ++distIt;
-        }
-        return expLoss ;
-    }
-
-    template<class CP>
-    // again, I am duplicating code.
     Real RecursiveLossModel<CP>::expectedConditionalLossInvP(
                                  const std::vector<Real>& invPDefDate, 
-                                 //const Date& date,
                                  const std::vector<Real>& mktFactor) const 
     {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistribInvP(invPDefDate, mktFactor);
+        std::vector<Probability> pDef(remainingBsktSize_);
+        for(Size iName=0; iName<remainingBsktSize_; ++iName)
+            pDef[iName] = copula_->conditionalDefaultProbabilityInvP(
+                invPDefDate[iName], iName, mktFactor);
+        std::vector<Probability> density;
+        conditionalLossDensity(pDef, density);
 
         // get the expected value subject to the value of the market
         //   factor.
         Real expLoss = 0.;
-        //---------------------------------------------------------------
-        /* This is the original (easy to read) loop which I have partially
-             unroll below to take profit of the fact that once we go over
-             the tranche top the loss amount is fixed:
-        */
-        auto distIt = pIndepDistrib.begin();
-
-        while(distIt != pIndepDistrib.end()) {
-            Real loss = distIt->first * lossUnit_;
-   //         loss = std::max(std::min(loss, detachAmount_)-attachAmount_, 0.);
+        for(Size k=0; k<density.size(); ++k) {
+            if(!attainable_[k])
+                continue;
+            Real loss = k * lossUnit_;
             loss = std::min(std::max(loss - attachAmount_, 0.), 
                 detachAmount_ - attachAmount_);
             // MIN MAX BUGS ....???
-            expLoss += loss * distIt->second;
-            ++distIt;
+            expLoss += loss * density[k];
         }
         return expLoss ;
     }
 
     template<class CP>
-    Disposable<std::vector<Real> > RecursiveLossModel<CP>::conditionalLossProb(
-        const std::vector<Probability>& pDefDate, 
-        //const Date& date,
+    Disposable<std::vector<Real> >
+    RecursiveLossModel<CP>::conditionalLossProbInvP(
+        const std::vector<Real>& invPDefDate,
+        const std::vector<bool>& negligible,
         const std::vector<Real>& mktFactor) const 
     {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistrib(pDefDate, mktFactor);
+        std::vector<Probability> pDef(remainingBsktSize_, 0.);
+        for(Size iName=0; iName<remainingBsktSize_; ++iName)
+            if(!negligible[iName])
+                pDef[iName] = copula_->conditionalDefaultProbabilityInvP(
+                    invPDefDate[iName], iName, mktFactor);
+        std::vector<Probability> density;
+        conditionalLossDensity(pDef, density);
 
         std::vector<Real> results;
-        auto distIt = pIndepDistrib.begin();
-        while(distIt != pIndepDistrib.end()) {
-            //Real loss = distIt->first * loss_unit_
-            //                    ;
-            //loss = std::max(std::min(loss,
-            //    results_.xMax)-results_.xMin, 0.);
-            //expLoss += loss * distIt->second;
-
-            results.push_back(distIt->second);
-             ++distIt;
-        }
+        for(Size k=0; k<density.size(); ++k)
+            if(attainable_[k])
+                results.push_back(density[k]);
         return results;
     }
 
@@ -63,10 +63,16 @@ namespace QuantLib {
                 //Assign X=lb+(ub-lb)*random
                 x[j] = lX_[j] + bounds[j] * sample[j];
             }
-            //Evaluate point
-            values_.emplace_back(P.value(x), i);
         }
 
+        //Evaluate points
+        Matrix X(M_, N_);
+        for (Size i = 0; i < M_; i++)
+            std::copy(x_[i].begin(), x_[i].end(), X.row_begin(i));
+        const Array F = P.batchValue(X);
+        for (Size i = 0; i < M_; i++)
+            values_.emplace_back(F[i], i);
+
         //init intensity & randomWalk
         intensity_->init(this);
         randomWalk_->init(this);
@@ -173,29 +179,39 @@ namespace QuantLib {
                 randomWalk_->walk();
 
                 //Loop over particles
+                Matrix Z(Mfa_, N_);
                 for (Size i = 0; i < Mfa_; i++) {
                     Size index = values_[i].second;
-                    Array& x   = x_[index];
-                    Array& xI  = xI_[index];
-                    Array& xRW = xRW_[index];
+                    const Array& x   = x_[index];
+                    const Array& xI  = xI_[index];
+                    const Array& xRW = xRW_[index];
+                    Matrix::row_iterator zi = Z.row_begin(i);
 
                     //Loop over dimensions
                     for (Size j = 0; j < N_; j++) {
                         //Update position
-                        z[j] = x[j] + xI[j] + xRW[j];
+                        zi[j] = x[j] + xI[j] + xRW[j];
                         //Enforce bounds on positions
-                        if (z[j] < lX_[j]) {
-                            z[j] = lX_[j];
+                        if (zi[j] < lX_[j]) {
+                            zi[j] = lX_[j];
                         }
-                        else if (z[j] > uX_[j]) {
-                            z[j] = uX_[j];
+                        else if (zi[j] > uX_[j]) {
+                            zi[j] = uX_[j];
                         }
                     }
-                    Real val = P.value(z);
+                }
+
+                //Evaluate all new positions at once
+                const Array F = P.batchValue(Z);
+
+                for (Size i = 0; i < Mfa_; i++) {
+                    Size index = values_[i].second;
+                    Array& x = x_[index];
+                    Real val = F[i];
                     if(!std::isnan(val))
 					{
 						//Accept new point
-                        x = z;
+                        std::copy(Z.row_begin(i), Z.row_end(i), x.begin());
                         values_[index].first = val;
                         //mark best
                         if (val < bestValue) {
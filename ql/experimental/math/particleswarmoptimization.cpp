@@ -82,11 +82,13 @@ namespace QuantLib {
                 //Assign V=(ub-lb)*2*random-(ub-lb) -> between (lb-ub) and (ub-lb)
                 v[j] = bounds[j] * (2.0*sample[2 * j + 1] - 1.0);
             }
-            //Evaluate X and assign as personal best
+            //Assign X as personal best
             pBX_.push_back(X_.back());
-            pBF_[i] = P.value(X_.back());
         }
 
+        //Evaluate the initial swarm
+        pBF_ = P.batchValue(swarmPositions());
+
         //init topology & inertia
         topology_->init(this);
         inertia_->init(this);
@@ -150,8 +152,17 @@ namespace QuantLib {
                         v[j] = 0.0;
                     }
                 }
-                //Evaluate x
-                Real f = P.value(x);
+            }
+
+            //Evaluate all particles at once, the positions do not
+            //depend on the function values of the current iteration
+            const Array F = P.batchValue(swarmPositions());
+
+            //Loop over particles
+            for (Size i = 0; i < M_; i++) {
+                const Array& x = X_[i];
+                Array& pB = pBX_[i];
+                const Real f = F[i];
                 if (f < pBF_[i]) {
                     //Update personal best
                     pBF_[i] = f;
@@ -176,6 +187,13 @@ namespace QuantLib {
         return ecType;
     }
 
+    Matrix ParticleSwarmOptimization::swarmPositions() const {
+        Matrix positions(M_, N_);
+        for (Size i = 0; i < M_; i++)
+            std::copy(X_[i].begin(), X_[i].end(), positions.row_begin(i));
+        return positions;
+    }
+
     void AdaptiveInertia::setValues() {
         Real currBest = (*pBF_)[0];
         for (Size i = 1; i < M_; i++) {
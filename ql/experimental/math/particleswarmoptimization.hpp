@@ -116,6 +116,9 @@ namespace QuantLib {
         EndCriteria::Type minimize(Problem& P, const EndCriteria& endCriteria) override;
 
       protected:
+        //! current particle positions, one per row
+        Matrix swarmPositions() const;
+
         std::vector<Array> X_, V_, pBX_, gBX_;
         Array pBF_, gBF_;
         Array lX_, uX_;
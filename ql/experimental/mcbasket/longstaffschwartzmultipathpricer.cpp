@@ -182,8 +182,8 @@ namespace QuantLib {
         std::vector<bool> lsExercise(n);
 
         for (Integer i = len - 2; i >= 0; --i) {
-            std::vector<Real>  y;
-            std::vector<Array> x;
+            std::vector<Real> y;
+            std::vector<Size> x;
 
             // prices are discounted up to time i
             const Real discountRatio = dF_[i + 1] / dF_[i];
@@ -206,13 +206,20 @@ namespace QuantLib {
 
                 // if exercise is lower than minimum continuation value, no point in considering it
                 if (!states.empty() && exercise[j] > lowerBounds_[i + 1]) {
-                    x.push_back(states);
+                    x.push_back(j);
                     y.push_back(prices[j]);
                 }
             }
 
+            // basis functions at the regression states, evaluated once
+            // and used for both the regression and the continuation values
+            Matrix A(x.size(), v_.size());
+            for (Size k = 0; k < x.size(); ++k)
+                for (Size l = 0; l < v_.size(); ++l)
+                    A[k][l] = v_[l](paths_[x[k]].states[i]);
+
             if (v_.size() <=  x.size()) {
-                coeff_[i] = GeneralLinearLeastSquares(x, y, v_).coefficients();
+                coeff_[i] = GeneralLinearLeastSquares(A, y).coefficients();
             }
             else {
             // if number of itm paths is smaller then the number of
@@ -240,7 +247,7 @@ namespace QuantLib {
                     if (!coeff_[i].empty() && exercise[j] > lowerBounds_[i + 1]) {
                         Real continuationValue = 0.0;
                         for (Size l = 0; l < v_.size(); ++l) {
-                            continuationValue += coeff_[i][l] * v_[l](x[k]);
+                            continuationValue += coeff_[i][l] * A[k][l];
                         }
                         
                         if (continuationValue < exercise[j]) {
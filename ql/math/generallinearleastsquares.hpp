@@ -32,6 +32,7 @@
 #include <ql/math/array.hpp>
 #include <ql/math/functional.hpp>
 #include <boost/type_traits.hpp>
+#include <iterator>
 #include <vector>
 
 namespace QuantLib {
@@ -55,6 +56,15 @@ namespace QuantLib {
                                   yIterator yBegin, yIterator yEnd,
                                   vIterator vBegin, vIterator vEnd);
 
+        /*! regression on a precomputed design matrix, whose element
+            (i,j) is the j-th basis function evaluated at the i-th
+            sample.  Callers that need the basis functions at the
+            sample points after the regression can build the matrix
+            once and reuse it instead of evaluating them again.
+        */
+        template <class yContainer>
+        GeneralLinearLeastSquares(const Matrix& A, const yContainer& y);
+
         const Array& coefficients()   const { return a_; }
         const Array& residuals()      const { return residuals_; }
 
@@ -75,6 +85,8 @@ namespace QuantLib {
             xIterator xBegin, xIterator xEnd,
             yIterator yBegin, yIterator yEnd,
             vIterator vBegin);
+        template <class yIterator>
+        void calculate(const Matrix& A, yIterator yBegin, yIterator yEnd);
     };
 
     template <class xContainer, class yContainer, class vContainer> inline
@@ -101,6 +113,18 @@ namespace QuantLib {
     }
 
 
+    template <class yContainer> inline
+    GeneralLinearLeastSquares::GeneralLinearLeastSquares(const Matrix& A,
+                                                         const yContainer& y)
+    : a_(A.columns(), 0.0),
+      err_(A.columns(), 0.0),
+      residuals_(y.size()),
+      standardErrors_(A.columns()) {
+        QL_REQUIRE(A.rows() == y.size(),
+                   "sample set need to be of the same size");
+        calculate(A, y.begin(), y.end());
+    }
+
     template <class xIterator, class yIterator, class vIterator>
     void GeneralLinearLeastSquares::calculate(xIterator xBegin, xIterator xEnd,
                                               yIterator yBegin, yIterator yEnd,
@@ -111,14 +135,28 @@ namespace QuantLib {
 
         QL_REQUIRE( n == Size(std::distance(yBegin, yEnd)),
             "sample set need to be of the same size");
-        QL_REQUIRE(n >= m, "sample set is too small");
-
-        Size i;
 
         Matrix A(n, m);
-        for (i=0; i<m; ++i)
+        for (Size i=0; i<m; ++i)
             std::transform(xBegin, xEnd, A.column_begin(i), *vBegin++);
 
+        calculate(A, yBegin, yEnd);
+    }
+
+    template <class yIterator>
+    void GeneralLinearLeastSquares::calculate(const Matrix& A,
+                                              yIterator yBegin,
+                                              yIterator yEnd) {
+
+        const Size n = A.rows();
+        const Size m = A.columns();
+
+        QL_REQUIRE(n == Size(std::distance(yBegin, yEnd)),
+                   "sample set need to be of the same size");
+        QL_REQUIRE(n >= m, "sample set is too small");
+
+        Size i;
+
         const SVD svd(A);
         const Matrix& V = svd.V();
         const Matrix& U = svd.U();
@@ -42,12 +42,25 @@
 #include <ql/pricingengines/blackformula.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/utilities/null.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace QuantLib {
 
 namespace detail {
 
+/*! true if the model specs provide the derivatives of the parameter
+    transformation (directDerivative) and the model instance returns
+    the volatility gradient with respect to the parameters. In this
+    case the calibration uses analytic Jacobians.
+*/
+template <typename Model, typename = void>
+struct XABRHasAnalyticJacobian : std::false_type {};
+
+template <typename Model>
+struct XABRHasAnalyticJacobian<
+    Model, decltype(&Model::directDerivative, void())> : std::true_type {};
+
 template <typename Model> class XABRCoeffHolder {
   public:
     XABRCoeffHolder(const Time t,
@@ -309,7 +322,59 @@ class XABRInterpolationImpl : public Interpolation::templateImpl<I1, I2>,
             return xabr_->interpolationErrors();
         }
 
+        void gradient(Array& grad, const Array& x) const override {
+            gradient(grad, x, XABRHasAnalyticJacobian<Model>());
+        }
+
+        void jacobian(Matrix& jac, const Array& x) const override {
+            jacobian(jac, x, XABRHasAnalyticJacobian<Model>());
+        }
+
+        bool hasAnalyticDerivatives() const override {
+            return XABRHasAnalyticJacobian<Model>::value;
+        }
+
       private:
+        void gradient(Array& grad, const Array& x, std::false_type) const {
+            CostFunction::gradient(grad, x);
+        }
+
+        void jacobian(Matrix& jac, const Array& x, std::false_type) const {
+            CostFunction::jacobian(jac, x);
+        }
+
+        void gradient(Array& grad, const Array& x, std::true_type) const {
+            // value() is the sum of the squared weighted errors
+            Matrix jac(xabr_->xEnd_ - xabr_->xBegin_, x.size());
+            jacobian(jac, x, std::true_type());
+            const Array errors = xabr_->interpolationErrors();
+            for (Size j = 0; j < x.size(); ++j) {
+                grad[j] = 0.0;
+                for (Size i = 0; i < errors.size(); ++i)
+                    grad[j] += 2.0 * errors[i] * jac[i][j];
+            }
+        }
+
+        void jacobian(Matrix& jac, const Array& x, std::true_type) const {
+            const Array y = Model().direct(x, xabr_->paramIsFixed_,
+                                           xabr_->params_, xabr_->forward_);
+            const Array dydx = Model().directDerivative(
+                x, xabr_->paramIsFixed_, xabr_->params_, xabr_->forward_);
+            for (Size i = 0; i < xabr_->params_.size(); ++i)
+                xabr_->params_[i] = y[i];
+            xabr_->updateModelInstance();
+
+            Array volGradient(x.size());
+            I1 k = xabr_->xBegin_;
+            auto w = xabr_->weights_.begin();
+            for (Size i = 0; k != xabr_->xEnd_; ++k, ++w, ++i) {
+                xabr_->modelInstance_->volatility(*k, volGradient);
+                const Real sqrtW = std::sqrt(*w);
+                for (Size j = 0; j < x.size(); ++j)
+                    jac[i][j] = sqrtW * volGradient[j] * dydx[j];
+            }
+        }
+
         XABRInterpolationImpl *xabr_;
     };
     ext::shared_ptr<EndCriteria> endCriteria_;
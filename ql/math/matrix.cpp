@@ -22,6 +22,8 @@
 */
 
 #include <ql/math/matrix.hpp>
+#include <ql/math/matrixutilities/blaslapack.hpp>
+#include <algorithm>
 #if defined(QL_PATCH_MSVC)
 #pragma warning(push)
 #pragma warning(disable:4180)
@@ -62,6 +64,68 @@
 
 namespace QuantLib {
 
+    namespace {
+        // block size chosen such that three blocks fit into L2 cache
+        const Size matrixBlockSize = 64;
+    }
+
+    Disposable<Matrix> operator*(const Matrix& m1, const Matrix& m2) {
+        QL_REQUIRE(m1.columns() == m2.rows(),
+                   "matrices with different sizes (" <<
+                   m1.rows() << "x" << m1.columns() << ", " <<
+                   m2.rows() << "x" << m2.columns() << ") cannot be "
+                   "multiplied");
+        Matrix result(m1.rows(),m2.columns(),0.0);
+
+        #if defined(QL_USE_BLAS_LAPACK)
+        if (!result.empty() && m1.columns() > 0) {
+            detail::blasMatrixProduct(m1, m2, result);
+            return result;
+        }
+        #endif
+
+        /* cache-blocked i-k-j loop. The innermost loop runs over
+           contiguous rows and can be vectorized by the compiler. The
+           summation order over k is the same as for the plain triple
+           loop, hence the results are identical.
+        */
+        const Size rows = m1.rows(), cols = m2.columns(), l = m1.columns();
+        for (Size kk=0; kk<l; kk+=matrixBlockSize) {
+            const Size kEnd = std::min(kk+matrixBlockSize, l);
+            for (Size jj=0; jj<cols; jj+=matrixBlockSize) {
+                const Size jEnd = std::min(jj+matrixBlockSize, cols);
+                for (Size i=0; i<rows; ++i) {
+                    const Matrix::const_row_iterator a = m1.row_begin(i);
+                    const Matrix::row_iterator r = result.row_begin(i);
+                    for (Size k=kk; k<kEnd; ++k) {
+                        const Real aik = a[k];
+                        const Matrix::const_row_iterator b = m2.row_begin(k);
+                        for (Size j=jj; j<jEnd; ++j)
+                            r[j] += aik*b[j];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    Disposable<Matrix> transpose(const Matrix& m) {
+        Matrix result(m.columns(),m.rows());
+        const Size rows = m.rows(), cols = m.columns();
+        for (Size ii=0; ii<rows; ii+=matrixBlockSize) {
+            const Size iEnd = std::min(ii+matrixBlockSize, rows);
+            for (Size jj=0; jj<cols; jj+=matrixBlockSize) {
+                const Size jEnd = std::min(jj+matrixBlockSize, cols);
+                for (Size i=ii; i<iEnd; ++i) {
+                    const Matrix::const_row_iterator row = m.row_begin(i);
+                    for (Size j=jj; j<jEnd; ++j)
+                        result[j][i] = row[j];
+                }
+            }
+        }
+        return result;
+    }
+
     Disposable<Matrix> inverse(const Matrix& m) {
         #if !defined(QL_NO_UBLAS_SUPPORT)
 
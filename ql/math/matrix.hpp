@@ -564,11 +564,14 @@ namespace QuantLib {
                    "vectors and matrices with different sizes ("
                    << v.size() << ", " << m.rows() << "x" << m.columns() <<
                    ") cannot be multiplied");
-        Array result(m.columns());
-        for (Size i=0; i<result.size(); i++)
-            result[i] =
-                std::inner_product(v.begin(),v.end(),
-                                   m.column_begin(i),0.0);
+        Array result(m.columns(), 0.0);
+        // row-wise traversal keeps the memory access contiguous
+        for (Size i=0; i<m.rows(); i++) {
+            const Real vi = v[i];
+            Matrix::const_row_iterator row = m.row_begin(i);
+            for (Size j=0; j<result.size(); j++)
+                result[j] += vi*row[j];
+        }
         return result;
     }
 
@@ -584,33 +587,6 @@ namespace QuantLib {
         return result;
     }
 
-    inline Disposable<Matrix> operator*(const Matrix& m1, const Matrix& m2) {
-        QL_REQUIRE(m1.columns() == m2.rows(),
-                   "matrices with different sizes (" <<
-                   m1.rows() << "x" << m1.columns() << ", " <<
-                   m2.rows() << "x" << m2.columns() << ") cannot be "
-                   "multiplied");
-        Matrix result(m1.rows(),m2.columns(),0.0);
-        for (Size i=0; i<result.rows(); ++i) {
-            for (Size k=0; k<m1.columns(); ++k) {
-                for (Size j=0; j<result.columns(); ++j) {
-                    result[i][j] += m1[i][k]*m2[k][j];
-                }
-            }
-        }
-        return result;
-    }
-
-    inline Disposable<Matrix> transpose(const Matrix& m) {
-        Matrix result(m.columns(),m.rows());
-        #if defined(QL_PATCH_MSVC) && defined(QL_DEBUG)
-        if (!m.empty())
-        #endif
-        for (Size i=0; i<m.rows(); i++)
-            std::copy(m.row_begin(i),m.row_end(i),result.column_begin(i));
-        return result;
-    }
-
     inline Disposable<Matrix> outerProduct(const Array& v1, const Array& v2) {
         return outerProduct(v1.begin(), v1.end(), v2.begin(), v2.end());
     }
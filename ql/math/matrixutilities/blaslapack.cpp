@@ -0,0 +1,186 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/matrixutilities/blaslapack.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#if defined(QL_USE_BLAS_LAPACK)
+extern "C" {
+    void dgemm_(const char* transa, const char* transb,
+                const int* m, const int* n, const int* k,
+                const double* alpha, const double* a, const int* lda,
+                const double* b, const int* ldb,
+                const double* beta, double* c, const int* ldc);
+
+    void dpotrf_(const char* uplo, const int* n,
+                 double* a, const int* lda, int* info);
+
+    void dsyevd_(const char* jobz, const char* uplo, const int* n,
+                 double* a, const int* lda, double* w,
+                 double* work, const int* lwork,
+                 int* iwork, const int* liwork, int* info);
+
+    void dgesvd_(const char* jobu, const char* jobvt,
+                 const int* m, const int* n, double* a, const int* lda,
+                 double* s, double* u, const int* ldu,
+                 double* vt, const int* ldvt,
+                 double* work, const int* lwork, int* info);
+}
+#endif
+
+namespace QuantLib {
+
+    namespace detail {
+
+        /* BLAS and LAPACK expect column-major storage whereas Matrix
+           is row-major, i.e. LAPACK sees the transpose of every Matrix
+           buffer. The functions below are arranged accordingly.
+        */
+
+        #if defined(QL_USE_BLAS_LAPACK)
+
+        namespace {
+            // the Fortran interfaces take 32 bit integer dimensions
+            int fortranInt(Size n) {
+                QL_REQUIRE(n <= Size(std::numeric_limits<int>::max()),
+                           "matrix dimension " << n << " exceeds the "
+                           "range of the BLAS/LAPACK integer type");
+                return int(n);
+            }
+        }
+
+        void blasMatrixProduct(const Matrix& a, const Matrix& b,
+                               Matrix& result) {
+            QL_REQUIRE(a.columns() == b.rows()
+                       && result.rows() == a.rows()
+                       && result.columns() == b.columns(),
+                       "matrices with incompatible sizes");
+
+            // result^T = b^T a^T in column-major storage
+            const int m = fortranInt(b.columns()), n = fortranInt(a.rows()),
+                k = fortranInt(a.columns());
+            const double alpha = 1.0, beta = 0.0;
+            dgemm_("N", "N", &m, &n, &k, &alpha,
+                   b.begin(), &m, a.begin(), &k, &beta, result.begin(), &m);
+        }
+
+        bool lapackCholeskyDecomposition(Matrix& s) {
+            QL_REQUIRE(s.rows() == s.columns(),
+                       "input matrix is not a square matrix");
+
+            // the upper factor of s^T = s is the lower factor in
+            // row-major storage
+            const int n = fortranInt(s.rows());
+            int info;
+            dpotrf_("U", &n, s.begin(), &n, &info);
+            QL_REQUIRE(info >= 0, "dpotrf: illegal argument " << -info);
+
+            for (Size i=0; i < s.rows(); ++i)
+                std::fill(s.row_begin(i)+i+1, s.row_end(i), 0.0);
+
+            return info == 0;
+        }
+
+        void lapackSymmetricEigenDecomposition(Matrix& s,
+                                               Array& eigenValues) {
+            QL_REQUIRE(s.rows() == s.columns(),
+                       "input matrix must be square");
+
+            const int n = fortranInt(s.rows());
+            eigenValues = Array(s.rows());
+
+            // workspace query
+            int info, lwork = -1, liwork = -1, iworkSize;
+            double workSize;
+            dsyevd_("V", "U", &n, s.begin(), &n, eigenValues.begin(),
+                    &workSize, &lwork, &iworkSize, &liwork, &info);
+            QL_REQUIRE(info == 0, "dsyevd workspace query failed");
+
+            lwork = int(workSize);
+            liwork = iworkSize;
+            std::vector<double> work(lwork);
+            std::vector<int> iwork(liwork);
+
+            dsyevd_("V", "U", &n, s.begin(), &n, eigenValues.begin(),
+                    &work[0], &lwork, &iwork[0], &liwork, &info);
+            QL_REQUIRE(info == 0, "dsyevd failed to converge");
+
+            // eigenvectors are the columns in column-major storage
+            s = transpose(s);
+        }
+
+        void lapackSingularValueDecomposition(const Matrix& a,
+                                              Matrix& u,
+                                              Array& s,
+                                              Matrix& v) {
+            QL_REQUIRE(a.rows() >= a.columns(),
+                       "more rows than columns required");
+
+            /* LAPACK decomposes a^T = U1 S V1^T, hence a = V1 S U1^T.
+               The row-major buffer of V1^T is V1 and the column-major
+               buffer of U1 is read with swapped indices.
+            */
+            const int m = fortranInt(a.columns()), n = fortranInt(a.rows());
+            Matrix tmp = a;
+            Matrix u1(a.columns(), a.columns());
+            u = Matrix(a.rows(), a.columns());
+            s = Array(a.columns());
+
+            int info, lwork = -1;
+            double workSize;
+            dgesvd_("S", "S", &m, &n, tmp.begin(), &m, s.begin(),
+                    u1.begin(), &m, u.begin(), &m,
+                    &workSize, &lwork, &info);
+            QL_REQUIRE(info == 0, "dgesvd workspace query failed");
+
+            lwork = int(workSize);
+            std::vector<double> work(lwork);
+            dgesvd_("S", "S", &m, &n, tmp.begin(), &m, s.begin(),
+                    u1.begin(), &m, u.begin(), &m,
+                    &work[0], &lwork, &info);
+            QL_REQUIRE(info == 0, "dgesvd failed to converge");
+
+            v = transpose(u1);
+        }
+
+        #else
+
+        void blasMatrixProduct(const Matrix&, const Matrix&, Matrix&) {
+            QL_FAIL("QuantLib was compiled without BLAS/LAPACK support");
+        }
+
+        bool lapackCholeskyDecomposition(Matrix&) {
+            QL_FAIL("QuantLib was compiled without BLAS/LAPACK support");
+        }
+
+        void lapackSymmetricEigenDecomposition(Matrix&, Array&) {
+            QL_FAIL("QuantLib was compiled without BLAS/LAPACK support");
+        }
+
+        void lapackSingularValueDecomposition(const Matrix&,
+                                              Matrix&, Array&, Matrix&) {
+            QL_FAIL("QuantLib was compiled without BLAS/LAPACK support");
+        }
+
+        #endif
+    }
+
+}
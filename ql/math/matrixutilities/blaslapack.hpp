@@ -0,0 +1,68 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file blaslapack.hpp
+    \brief optional BLAS/LAPACK backend for dense matrix kernels
+*/
+
+#ifndef quantlib_blas_lapack_hpp
+#define quantlib_blas_lapack_hpp
+
+#include <ql/math/matrix.hpp>
+
+namespace QuantLib {
+
+    namespace detail {
+
+        /*! The following functions dispatch to a system BLAS/LAPACK
+            library. They are only available if QuantLib was compiled
+            with QL_USE_BLAS_LAPACK defined, e.g. by configuring CMake
+            with -DUSE_BLAS_LAPACK=ON; otherwise they throw.
+        */
+
+        //! result = a*b using dgemm
+        void blasMatrixProduct(const Matrix& a, const Matrix& b,
+                               Matrix& result);
+
+        /*! overwrites the symmetric matrix s with its lower Cholesky
+            factor using dpotrf. Returns false if s is not positive
+            definite.
+        */
+        bool lapackCholeskyDecomposition(Matrix& s);
+
+        /*! overwrites the symmetric matrix s with its eigenvectors
+            (stored in the columns) using dsyevd, eigenvalues are
+            returned in ascending order.
+        */
+        void lapackSymmetricEigenDecomposition(Matrix& s,
+                                               Array& eigenValues);
+
+        /*! singular value decomposition a = u diag(s) v^T of a matrix
+            with a.rows() >= a.columns() using dgesvd. The singular
+            values are returned in descending order.
+        */
+        void lapackSingularValueDecomposition(const Matrix& a,
+                                              Matrix& u,
+                                              Array& s,
+                                              Matrix& v);
+    }
+
+}
+
+#endif
@@ -20,6 +20,7 @@
 
 #include <ql/math/matrixutilities/choleskydecomposition.hpp>
 #include <ql/math/comparison.hpp>
+#include <ql/math/matrixutilities/blaslapack.hpp>
 
 namespace QuantLib {
 
@@ -35,6 +36,15 @@ namespace QuantLib {
                            "input matrix is not symmetric");
         #endif
 
+        #if defined(QL_USE_BLAS_LAPACK)
+        if (!flexible && size > 0) {
+            Matrix result = S;
+            QL_REQUIRE(detail::lapackCholeskyDecomposition(result),
+                       "input matrix is not positive definite");
+            return result;
+        }
+        #endif
+
         Matrix result(size, size, 0.0);
         Real sum;
         for (i=0; i<size; i++) {
@@ -505,4 +505,63 @@ namespace QuantLib {
         normalizePseudoRoot(matrix, result);
         return result;
     }
+
+
+    PseudoSqrtCache::PseudoSqrtCache(Real tolerance)
+    : tolerance_(tolerance), hits_(0) {}
+
+    Disposable<Matrix> PseudoSqrtCache::rankReducedSqrt(
+                                      const Matrix& matrix,
+                                      Size maxRank,
+                                      Real componentRetainedPercentage,
+                                      SalvagingAlgorithm::Type sa) {
+        if (sa != SalvagingAlgorithm::None &&
+            sa != SalvagingAlgorithm::Spectral)
+            return QuantLib::rankReducedSqrt(matrix, maxRank,
+                                             componentRetainedPercentage, sa);
+
+        Size size = matrix.rows();
+        Real scale = 0.0, maxElement = 0.0;
+        for (Size i=0; i<size; ++i)
+            scale += matrix[i][i];
+        for (Matrix::const_iterator m=matrix.begin(); m!=matrix.end(); ++m)
+            maxElement = std::max(maxElement, std::fabs(*m));
+        if (scale <= 0.0)
+            return QuantLib::rankReducedSqrt(matrix, maxRank,
+                                             componentRetainedPercentage, sa);
+
+        for (const auto& entry : entries_) {
+            if (entry.matrix.rows() != size ||
+                entry.matrix.columns() != matrix.columns() ||
+                entry.maxRank != maxRank ||
+                entry.componentRetainedPercentage !=
+                                            componentRetainedPercentage ||
+                entry.salvaging != sa)
+                continue;
+
+            // is the matrix proportional to the stored one?
+            Real ratio = scale/entry.scale;
+            bool proportional = true;
+            for (Matrix::const_iterator m=matrix.begin(),
+                     e=entry.matrix.begin();
+                 m!=matrix.end() && proportional; ++m, ++e)
+                proportional =
+                    std::fabs(*m - ratio * *e) <= tolerance_*maxElement;
+
+            if (proportional) {
+                ++hits_;
+                Matrix result = std::sqrt(ratio) * entry.pseudoRoot;
+                normalizePseudoRoot(matrix, result);
+                return result;
+            }
+        }
+
+        Matrix result = QuantLib::rankReducedSqrt(
+                      matrix, maxRank, componentRetainedPercentage, sa);
+        Entry entry = { matrix, result, scale, maxRank,
+                        componentRetainedPercentage, sa };
+        entries_.push_back(entry);
+        return result;
+    }
+
 }
@@ -25,6 +25,7 @@
 #define quantlib_pseudo_sqrt_hpp
 
 #include <ql/math/matrix.hpp>
+#include <vector>
 
 namespace QuantLib {
 
@@ -81,6 +82,47 @@ namespace QuantLib {
                                        Size maxRank,
                                        Real componentRetainedPercentage,
                                        SalvagingAlgorithm::Type);
+
+    //! Memoized rank-reduced pseudo square roots
+    /*! Market-model setups compute one pseudo square root per
+        evolution step, and the covariance matrices of different steps
+        are often proportional to each other (e.g., flat volatilities
+        with piecewise-constant correlations.)  The cache stores the
+        pseudo square roots it computes; when asked for one of a matrix
+        proportional, within the given tolerance, to a stored one, it
+        rescales the stored result and normalizes it to the diagonal of
+        the new matrix instead of performing a new decomposition.
+
+        Only the spectral decompositions (i.e., with the None and
+        Spectral salvaging algorithms) are memoized, since their
+        factor reduction is invariant under scaling; other algorithms
+        are forwarded to rankReducedSqrt.
+
+        \pre the given matrices must be symmetric.
+    */
+    class PseudoSqrtCache {
+      public:
+        explicit PseudoSqrtCache(Real tolerance = 1.0e-12);
+        Disposable<Matrix> rankReducedSqrt(const Matrix&,
+                                           Size maxRank,
+                                           Real componentRetainedPercentage,
+                                           SalvagingAlgorithm::Type);
+        //! number of decompositions stored
+        Size size() const { return entries_.size(); }
+        //! number of requests served from the cache
+        Size hits() const { return hits_; }
+      private:
+        struct Entry {
+            Matrix matrix, pseudoRoot;
+            Real scale;
+            Size maxRank;
+            Real componentRetainedPercentage;
+            SalvagingAlgorithm::Type salvaging;
+        };
+        Real tolerance_;
+        std::vector<Entry> entries_;
+        Size hits_;
+    };
 }
 
 
@@ -34,6 +34,7 @@
 
 
 #include <ql/math/matrixutilities/svd.hpp>
+#include <ql/math/matrixutilities/blaslapack.hpp>
 
 namespace QuantLib {
 
@@ -91,6 +92,10 @@ namespace QuantLib {
 
         // we're sure that m_ >= n_
 
+        #if defined(QL_USE_BLAS_LAPACK)
+        detail::lapackSingularValueDecomposition(A, U_, s_, V_);
+        #else
+
         s_ = Array(n_);
         U_ = Matrix(m_,n_, 0.0);
         V_ = Matrix(n_,n_);
@@ -480,6 +485,7 @@ namespace QuantLib {
                 break;
             }
         }
+        #endif
     }
 
     const Matrix& SVD::U() const {
@@ -19,6 +19,7 @@
 */
 
 #include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
+#include <ql/math/matrixutilities/blaslapack.hpp>
 #include <vector>
 
 namespace QuantLib {
@@ -30,6 +31,11 @@ namespace QuantLib {
         QL_REQUIRE(s.rows()==s.columns(), "input matrix must be square");
 
         Size size = s.rows();
+
+        #if defined(QL_USE_BLAS_LAPACK)
+        eigenVectors_ = s;
+        detail::lapackSymmetricEigenDecomposition(eigenVectors_, diagonal_);
+        #else
         for (Size q=0; q<size; q++) {
             diagonal_[q] = s[q][q];
             eigenVectors_[q][q] = 1.0;
@@ -110,6 +116,7 @@ namespace QuantLib {
 
         QL_ENSURE(ite<=maxIterations,
                   "Too many iterations (" << maxIterations << ") reached");
+        #endif
 
 
         // sort (eigenvalues, eigenvectors)
@@ -0,0 +1,56 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/optimization/costfunction.hpp>
+#include <string>
+
+namespace QuantLib {
+
+    Disposable<Array> CostFunction::batchValue(const Matrix& x) const {
+        Array result(x.rows());
+
+        if (isThreadSafe()) {
+            // exceptions must not escape the parallel region
+            bool failed = false;
+            std::string error;
+
+            #pragma omp parallel for
+            for (long i=0; i < long(x.rows()); ++i) {
+                try {
+                    result[i] = value(Array(x.row_begin(i), x.row_end(i)));
+                }
+                catch (std::exception& e) {
+                    #pragma omp critical
+                    {
+                        failed = true;
+                        error = e.what();
+                    }
+                }
+            }
+            QL_REQUIRE(!failed, error);
+        }
+        else {
+            for (Size i=0; i < x.rows(); ++i)
+                result[i] = value(Array(x.row_begin(i), x.row_end(i)));
+        }
+
+        return result;
+    }
+
+}
@@ -93,6 +93,26 @@ namespace QuantLib {
             return values(x);
         }
 
+        /*! method to overload to compute the cost function value for a
+            set of points, e.g. the population of an evolutionary
+            optimizer. Each row of x holds one point. The default
+            implementation evaluates the points in parallel if the cost
+            function is thread-safe and OpenMP is enabled.
+        */
+        virtual Disposable<Array> batchValue(const Matrix& x) const;
+
+        /*! returns true if value() can be called concurrently from
+            several threads.
+        */
+        virtual bool isThreadSafe() const { return false; }
+
+        /*! returns true if gradient() and jacobian() are overloaded
+            with analytic expressions. Optimizers such as
+            Levenberg-Marquardt use the cost function's Jacobian
+            instead of finite differences in this case.
+        */
+        virtual bool hasAnalyticDerivatives() const { return false; }
+
         //! Default epsilon for finite difference method :
         virtual Real finiteDifferenceEpsilon() const { return 1e-8; }
     };
@@ -33,6 +33,15 @@ namespace QuantLib {
             }
         };
 
+        Matrix populationValues(
+                const std::vector<DifferentialEvolution::Candidate>& population) {
+            Matrix x(population.size(), population.front().values.size());
+            for (Size i = 0; i < population.size(); ++i)
+                std::copy(population[i].values.begin(), population[i].values.end(),
+                          x.row_begin(i));
+            return x;
+        }
+
         template <class I>
         void randomize(I begin, I end,
                        const MersenneTwisterUniformRng& rng) {
@@ -74,8 +83,10 @@ namespace QuantLib {
                 population[i].values = configuration().initialPopulation[i];
                 QL_REQUIRE(population[i].values.size() == p.currentValue().size(),
                            "wrong values size in initial population");
-                population[i].cost = p.costFunction().value(population[i].values);
             }
+            const Array costs = p.costFunction().batchValue(populationValues(population));
+            for (Size i = 0; i < population.size(); ++i)
+                population[i].cost = costs[i];
         } else {
             population = std::vector<Candidate>(configuration().populationMembers,
                                                 Candidate(p.currentValue().size()));
@@ -293,15 +304,28 @@ namespace QuantLib {
                                - lowerBound_[memIter]);
                 }
             }
-            // evaluate objective function as soon as possible to avoid unnecessary loops
-            try {
-                population[popIter].cost = p.value(population[popIter].values);
-            } catch (Error&) {
-                population[popIter].cost = QL_MAX_REAL;
+        }
+
+        // evaluate the objective function for the whole population at once,
+        // the random numbers have been drawn before hence the results do
+        // not depend on the evaluation order
+        try {
+            const Array costs = p.batchValue(populationValues(population));
+            for (Size popIter = 0; popIter < population.size(); popIter++)
+                population[popIter].cost = costs[popIter];
+        } catch (Error&) {
+            // find out which candidates fail
+            for (Size popIter = 0; popIter < population.size(); popIter++) {
+                try {
+                    population[popIter].cost = p.value(population[popIter].values);
+                } catch (Error&) {
+                    population[popIter].cost = QL_MAX_REAL;
+                }
             }
+        }
+        for (Size popIter = 0; popIter < population.size(); popIter++) {
             if (!std::isfinite(population[popIter].cost))
                 population[popIter].cost = QL_MAX_REAL;
-
         }
     }
 
@@ -381,14 +405,18 @@ namespace QuantLib {
 
         // use initial values provided by the user
         population.front().values = p.currentValue();
-        population.front().cost = p.costFunction().value(population.front().values);
         // rest of the initial population is random
         for (Size j = 1; j < population.size(); ++j) {
             for (Size i = 0; i < p.currentValue().size(); ++i) {
                 Real l = lowerBound_[i], u = upperBound_[i];
                 population[j].values[i] = l + (u-l)*rng_.nextReal();
             }
-            population[j].cost = p.costFunction().value(population[j].values);
+        }
+
+        const Array costs = p.costFunction().batchValue(populationValues(population));
+        population.front().cost = costs.front();
+        for (Size j = 1; j < population.size(); ++j) {
+            population[j].cost = costs[j];
             if (!std::isfinite(population[j].cost))
                 population[j].cost = QL_MAX_REAL;
         }
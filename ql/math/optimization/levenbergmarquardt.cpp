@@ -48,7 +48,9 @@ namespace QuantLib {
         initCostValues_ = P.costFunction().values(x_);
         int m = initCostValues_.size();
         int n = x_.size();
-        if(useCostFunctionsJacobian_) {
+        const bool useJacobian = useCostFunctionsJacobian_ ||
+            P.costFunction().hasAnalyticDerivatives();
+        if(useJacobian) {
             initJacobian_ = Matrix(m,n);
             P.costFunction().jacobian(initJacobian_, x_);
         }
@@ -86,7 +88,7 @@ namespace QuantLib {
         MINPACK::LmdifCostFunction lmdifCostFunction =
             ext::bind(&LevenbergMarquardt::fcn, this, _1, _2, _3, _4, _5);
         MINPACK::LmdifCostFunction lmdifJacFunction =
-            useCostFunctionsJacobian_
+            useJacobian
                 ? ext::bind(&LevenbergMarquardt::jacFcn, this, _1, _2, _3, _4, _5)
                 : MINPACK::LmdifCostFunction();
         MINPACK::lmdif(m, n, xx.get(), fvec.get(),
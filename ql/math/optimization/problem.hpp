@@ -58,6 +58,11 @@ namespace QuantLib {
         //! call cost values computation and increment evaluation counter
         Disposable<Array> values(const Array& x);
 
+        /*! call cost function computation for a set of points stored
+            row-wise and increment evaluation counter accordingly
+        */
+        Disposable<Array> batchValue(const Matrix& x);
+
         //! call cost function gradient computation and increment
         //  evaluation counter
         void gradient(Array& grad_f,
@@ -123,6 +128,11 @@ namespace QuantLib {
         return costFunction_.values(x);
     }
 
+    inline Disposable<Array> Problem::batchValue(const Matrix& x) {
+        functionEvaluation_ += Integer(x.rows());
+        return costFunction_.batchValue(x);
+    }
+
     inline void Problem::gradient(Array& grad_f,
                                   const Array& x) {
         ++gradientEvaluation_;
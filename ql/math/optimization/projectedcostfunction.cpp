@@ -45,4 +45,40 @@ namespace QuantLib {
         return costFunction_.values(actualParameters_);
     }
 
+    void ProjectedCostFunction::gradient(Array& grad,
+                                         const Array& freeParameters) const {
+        if (!costFunction_.hasAnalyticDerivatives()) {
+            CostFunction::gradient(grad, freeParameters);
+            return;
+        }
+        mapFreeParameters(freeParameters);
+        Array fullGradient(actualParameters_.size());
+        costFunction_.gradient(fullGradient, actualParameters_);
+        for (Size i = 0, j = 0; i < fixParameters_.size(); ++i)
+            if (!fixParameters_[i])
+                grad[j++] = fullGradient[i];
+    }
+
+    void ProjectedCostFunction::jacobian(Matrix& jac,
+                                         const Array& freeParameters) const {
+        if (!costFunction_.hasAnalyticDerivatives()) {
+            CostFunction::jacobian(jac, freeParameters);
+            return;
+        }
+        mapFreeParameters(freeParameters);
+        Matrix fullJacobian(jac.rows(), actualParameters_.size());
+        costFunction_.jacobian(fullJacobian, actualParameters_);
+        for (Size i = 0, j = 0; i < fixParameters_.size(); ++i) {
+            if (!fixParameters_[i]) {
+                for (Size k = 0; k < jac.rows(); ++k)
+                    jac[k][j] = fullJacobian[k][i];
+                ++j;
+            }
+        }
+    }
+
+    bool ProjectedCostFunction::hasAnalyticDerivatives() const {
+        return costFunction_.hasAnalyticDerivatives();
+    }
+
 }
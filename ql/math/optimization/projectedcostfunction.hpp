@@ -49,6 +49,11 @@ namespace QuantLib {
             //@{
             Real value(const Array& freeParameters) const override;
             Disposable<Array> values(const Array& freeParameters) const override;
+            void gradient(Array& grad,
+                          const Array& freeParameters) const override;
+            void jacobian(Matrix& jac,
+                          const Array& freeParameters) const override;
+            bool hasAnalyticDerivatives() const override;
             //@}
 
         private:
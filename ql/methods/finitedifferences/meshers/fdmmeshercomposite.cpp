@@ -101,11 +101,13 @@ namespace QuantLib {
     Disposable<Array> FdmMesherComposite::locations(Size direction) const {
         Array retVal(layout_->size());
 
-        const FdmLinearOpIterator endIter = layout_->end();
-        for (FdmLinearOpIterator iter = layout_->begin();
-             iter != endIter; ++iter) {
-            retVal[iter.index()] =
-                mesher_[direction]->locations()[iter.coordinates()[direction]];
+        const std::vector<Real>& x = mesher_[direction]->locations();
+        const Size stride = layout_->spacing()[direction];
+
+        for (Size l=0; l < layout_->numberOfLines(direction); ++l) {
+            Real* const line = retVal.begin() + layout_->lineStart(direction, l);
+            for (Size k=0; k < x.size(); ++k)
+                line[k*stride] = x[k];
         }
 
         return retVal;
@@ -48,10 +48,13 @@ namespace QuantLib {
     Disposable<Array> UniformGridMesher::locations(Size d) const {
         Array retVal(layout_->size());
 
-        const FdmLinearOpIterator endIter = layout_->end();
-        for (FdmLinearOpIterator iter = layout_->begin();
-            iter != endIter; ++iter) {
-            retVal[iter.index()] = locations_[d][iter.coordinates()[d]];
+        const std::vector<Real>& x = locations_[d];
+        const Size stride = layout_->spacing()[d];
+
+        for (Size l=0; l < layout_->numberOfLines(d); ++l) {
+            Real* const line = retVal.begin() + layout_->lineStart(d, l);
+            for (Size k=0; k < x.size(); ++k)
+                line[k*stride] = x[k];
         }
 
         return retVal;
@@ -0,0 +1,84 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/methods/finitedifferences/meshers/fdmmesher.hpp>
+#include <ql/methods/finitedifferences/operators/compactconvectiondiffusionop.hpp>
+#include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
+#include <ql/methods/finitedifferences/operators/firstderivativeop.hpp>
+#include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
+
+namespace QuantLib {
+
+    CompactConvectionDiffusionOp::CompactConvectionDiffusionOp(
+        Size direction, const ext::shared_ptr<FdmMesher>& mesher)
+    : size_(mesher->layout()->size()),
+      dxMap_(FirstDerivativeOp(direction, mesher)),
+      dxxMap_(SecondDerivativeOp(direction, mesher)),
+      h2_(size_, 0.0),
+      m_(direction, mesher), b_(direction, mesher) {
+
+        const ext::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
+        const FdmLinearOpIterator endIter = layout->end();
+
+        for (FdmLinearOpIterator iter = layout->begin(); iter!=endIter; ++iter) {
+            const Size co = iter.coordinates()[direction];
+            if (co != 0 && co != layout->dim()[direction]-1) {
+                h2_[iter.index()] = mesher->dminus(iter, direction)
+                                   *mesher->dplus(iter, direction);
+            }
+        }
+
+        setCoefficients(Array(size_, 0.0), Array(size_, 0.0), 0.0);
+    }
+
+    void CompactConvectionDiffusionOp::setCoefficients(
+        const Array& a, const Array& b, Real c) {
+        QL_REQUIRE(a.size() == size_ && b.size() == size_,
+                   "inconsistent size of coefficients");
+
+        Array c1(size_), c2(size_), aEff(size_);
+        for (Size i=0; i < size_; ++i) {
+            const Real h2 = h2_[i];
+            if (h2 > 0.0 && a[i] > 0.0
+                && std::fabs(b[i])*std::sqrt(h2) <= 2.0*a[i]) {
+                c2[i] = h2/12.0;
+                c1[i] = c2[i]*b[i]/a[i];
+                aEff[i] = a[i] + c1[i]*b[i];
+            }
+            else {
+                c1[i] = c2[i] = 0.0;
+                aEff[i] = a[i];
+            }
+        }
+
+        m_ = dxxMap_.mult(c2).add(dxMap_.mult(c1)).add(Array(size_, 1.0));
+        b_ = dxxMap_.mult(aEff).add(dxMap_.mult(b))
+                                .add(m_.mult(Array(size_, c)));
+    }
+
+    Disposable<Array> CompactConvectionDiffusionOp::apply(const Array& r) const {
+        return m_.solve_splitting(b_.apply(r), 1.0, 0.0);
+    }
+
+    Disposable<Array> CompactConvectionDiffusionOp::solve_splitting(
+        const Array& r, Real s) const {
+        return b_.mult(Array(size_, s)).add(m_)
+                 .solve_splitting(m_.apply(r), 1.0, 0.0);
+    }
+}
@@ -36,7 +36,8 @@ namespace QuantLib {
         bool localVol,
         Real illegalLocalVolOverwrite,
         Size direction,
-        ext::shared_ptr<FdmQuantoHelper> quantoHelper)
+        ext::shared_ptr<FdmQuantoHelper> quantoHelper,
+        bool fourthOrderCompact)
     : mesher_(mesher), rTS_(bsProcess->riskFreeRate().currentLink()),
       qTS_(bsProcess->dividendYield().currentLink()),
       volTS_(bsProcess->blackVolatility().currentLink()),
@@ -46,7 +47,10 @@ namespace QuantLib {
       dxMap_(FirstDerivativeOp(direction, mesher)), dxxMap_(SecondDerivativeOp(direction, mesher)),
       mapT_(direction, mesher), strike_(strike),
       illegalLocalVolOverwrite_(illegalLocalVolOverwrite), direction_(direction),
-      quantoHelper_(std::move(quantoHelper)) {}
+      quantoHelper_(std::move(quantoHelper)),
+      compactMap_((fourthOrderCompact) ?
+                  ext::make_shared<CompactConvectionDiffusionOp>(direction, mesher) :
+                  ext::shared_ptr<CompactConvectionDiffusionOp>()) {}
 
     void FdmBlackScholesOp::setTime(Time t1, Time t2) {
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
@@ -76,44 +80,46 @@ namespace QuantLib {
                 }
             }
 
-            if (quantoHelper_ != nullptr) {
-                mapT_.axpyb(r - q - 0.5*v
-                    - quantoHelper_->quantoAdjustment(Sqrt(v), t1, t2),
-                    dxMap_, dxxMap_.mult(0.5*v), Array(1, -r));
-            } else {
-                mapT_.axpyb(r - q - 0.5*v, dxMap_,
-                            dxxMap_.mult(0.5*v), Array(1, -r));
-            }
+            Array drift = r - q - 0.5*v;
+            if (quantoHelper_ != nullptr)
+                drift -= quantoHelper_->quantoAdjustment(Sqrt(v), t1, t2);
+
+            if (compactMap_ != nullptr)
+                compactMap_->setCoefficients(0.5*v, drift, -r);
+            else
+                mapT_.axpyb(drift, dxMap_, dxxMap_.mult(0.5*v), Array(1, -r));
         } else {
             const Real v
                 = volTS_->blackForwardVariance(t1, t2, strike_)/(t2-t1);
 
-            if (quantoHelper_ != nullptr) {
-                mapT_.axpyb(
-                    Array(1, r - q - 0.5*v)
-                        - quantoHelper_->quantoAdjustment(
-                            Array(1, std::sqrt(v)), t1, t2),
-                    dxMap_,
-                    dxxMap_.mult(0.5*Array(mesher_->layout()->size(), v)),
-                    Array(1, -r));
-            } else {
-                mapT_.axpyb(Array(1, r - q - 0.5*v), dxMap_,
-                    dxxMap_.mult(0.5*Array(mesher_->layout()->size(), v)),
-                    Array(1, -r));
-            }
+            Array drift(1, r - q - 0.5*v);
+            if (quantoHelper_ != nullptr)
+                drift -= quantoHelper_->quantoAdjustment(
+                    Array(1, std::sqrt(v)), t1, t2);
+
+            const Size n = mesher_->layout()->size();
+            if (compactMap_ != nullptr)
+                compactMap_->setCoefficients(
+                    Array(n, 0.5*v), Array(n, drift[0]), -r);
+            else
+                mapT_.axpyb(drift, dxMap_,
+                    dxxMap_.mult(0.5*Array(n, v)), Array(1, -r));
         }
     }
 
     Size FdmBlackScholesOp::size() const { return 1U; }
 
     Disposable<Array> FdmBlackScholesOp::apply(const Array& u) const {
-        return mapT_.apply(u);
+        if (compactMap_ != nullptr)
+            return compactMap_->apply(u);
+        else
+            return mapT_.apply(u);
     }
 
     Disposable<Array> FdmBlackScholesOp::apply_direction(Size direction,
                                                     const Array& r) const {
         if (direction == direction_)
-            return mapT_.apply(r);
+            return apply(r);
         else {
             Array retVal(r.size(), 0.0);
             return retVal;
@@ -127,8 +133,12 @@ namespace QuantLib {
 
     Disposable<Array> FdmBlackScholesOp::solve_splitting(Size direction,
                                                 const Array& r, Real dt) const {
-        if (direction == direction_)
-            return mapT_.solve_splitting(r, dt, 1.0);
+        if (direction == direction_) {
+            if (compactMap_ != nullptr)
+                return compactMap_->solve_splitting(r, dt);
+            else
+                return mapT_.solve_splitting(r, dt, 1.0);
+        }
         else {
             Array retVal(r);
             return retVal;
@@ -143,6 +153,9 @@ namespace QuantLib {
 #if !defined(QL_NO_UBLAS_SUPPORT)
     Disposable<std::vector<SparseMatrix> >
     FdmBlackScholesOp::toMatrixDecomp() const {
+        QL_REQUIRE(compactMap_ == nullptr,
+                   "matrix representation is not available "
+                   "for the fourth-order compact operator");
         std::vector<SparseMatrix> retVal(1, mapT_.toMatrix());
         return retVal;
     }
@@ -33,23 +33,24 @@ namespace QuantLib {
                                              ext::shared_ptr<YieldTermStructure> rTS,
                                              ext::shared_ptr<YieldTermStructure> qTS,
                                              ext::shared_ptr<FdmQuantoHelper> quantoHelper,
-                                             ext::shared_ptr<LocalVolTermStructure> leverageFct)
+                                             ext::shared_ptr<LocalVolTermStructure> leverageFct,
+                                             bool fourthOrderCompact)
     : varianceValues_(0.5 * mesher->locations(1)), dxMap_(FirstDerivativeOp(0, mesher)),
       dxxMap_(SecondDerivativeOp(0, mesher).mult(0.5 * mesher->locations(1))), mapT_(0, mesher),
       mesher_(mesher), rTS_(std::move(rTS)), qTS_(std::move(qTS)),
-      quantoHelper_(std::move(quantoHelper)), leverageFct_(std::move(leverageFct)) {
+      quantoHelper_(std::move(quantoHelper)), leverageFct_(std::move(leverageFct)),
+      compactMap_((fourthOrderCompact) ?
+                  ext::make_shared<CompactConvectionDiffusionOp>(0, mesher) :
+                  ext::shared_ptr<CompactConvectionDiffusionOp>()) {
 
         // on the boundary s_min and s_max the second derivative
         // d^2V/dS^2 is zero and due to Ito's Lemma the variance term
         // in the drift should vanish.
-        ext::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
-        FdmLinearOpIterator endIter = layout->end();
-        for (FdmLinearOpIterator iter = layout->begin(); iter != endIter;
-            ++iter) {
-            if (   iter.coordinates()[0] == 0
-                || iter.coordinates()[0] == layout->dim()[0]-1) {
-                varianceValues_[iter.index()] = 0.0;
-            }
+        const ext::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
+        const Size n = layout->dim()[0];
+        for (Size l=0; l < layout->numberOfLines(0); ++l) {
+            const Size start = layout->lineStart(0, l);
+            varianceValues_[start] = varianceValues_[start + n-1] = 0.0;
         }
         volatilityValues_ = Sqrt(2*varianceValues_);
     }
@@ -61,15 +62,31 @@ namespace QuantLib {
         L_ = getLeverageFctSlice(t1, t2);
         const Array Lsquare = L_*L_;
 
-        if (quantoHelper_ != nullptr) {
-            mapT_.axpyb(r - q - varianceValues_*Lsquare
-                - quantoHelper_->quantoAdjustment(
-                    volatilityValues_*L_, t1, t2),
-                dxMap_, dxxMap_.mult(Lsquare), Array(1, -0.5*r));
-        } else {
-            mapT_.axpyb(r - q - varianceValues_*Lsquare, dxMap_,
-                        dxxMap_.mult(Lsquare), Array(1, -0.5*r));
-        }
+        Array drift = r - q - varianceValues_*Lsquare;
+        if (quantoHelper_ != nullptr)
+            drift -= quantoHelper_->quantoAdjustment(
+                volatilityValues_*L_, t1, t2);
+
+        if (compactMap_ != nullptr)
+            compactMap_->setCoefficients(
+                0.5*mesher_->locations(1)*Lsquare, drift, -0.5*r);
+        else
+            mapT_.axpyb(drift, dxMap_, dxxMap_.mult(Lsquare), Array(1, -0.5*r));
+    }
+
+    Disposable<Array> FdmHestonEquityPart::apply(const Array& r) const {
+        if (compactMap_ != nullptr)
+            return compactMap_->apply(r);
+        else
+            return mapT_.apply(r);
+    }
+
+    Disposable<Array> FdmHestonEquityPart::solve_splitting(
+        const Array& r, Real a) const {
+        if (compactMap_ != nullptr)
+            return compactMap_->solve_splitting(r, a);
+        else
+            return mapT_.solve_splitting(r, a, 1.0);
     }
 
     Disposable<Array> FdmHestonEquityPart::getLeverageFctSlice(Time t1, Time t2)
@@ -83,21 +100,19 @@ namespace QuantLib {
         const Real t = 0.5*(t1+t2);
         const Time time = std::min(leverageFct_->maxTime(), t);
 
-        const FdmLinearOpIterator endIter = layout->end();
-        for (FdmLinearOpIterator iter = layout->begin();
-             iter!=endIter; ++iter) {
-            const Size nx = iter.coordinates()[0];
-
-            if (iter.coordinates()[1] == 0) {
-                const Real x = std::exp(mesher_->location(iter, 0));
-                const Real spot = std::min(leverageFct_->maxStrike(),
-                                           std::max(leverageFct_->minStrike(), x));
-                v[nx] = std::max(0.01, leverageFct_->localVol(time, spot, true));
-            }
-            else {
-                v[iter.index()] = v[nx];
-            }
+        // the leverage function depends on the equity direction only,
+        // hence all lines along this direction share the same values
+        const Size n = layout->dim()[0];
+        const Array x = mesher_->locations(0);
+        for (Size nx=0; nx < n; ++nx) {
+            const Real spot = std::min(leverageFct_->maxStrike(),
+                std::max(leverageFct_->minStrike(), std::exp(x[nx])));
+            v[nx] = std::max(0.01, leverageFct_->localVol(time, spot, true));
         }
+        for (Size l=1; l < layout->numberOfLines(0); ++l)
+            std::copy(v.begin(), v.begin()+n,
+                      v.begin() + layout->lineStart(0, l));
+
         return v;
     }
 
@@ -130,7 +145,8 @@ namespace QuantLib {
         const ext::shared_ptr<HestonProcess> & hestonProcess,
         const ext::shared_ptr<FdmQuantoHelper>& quantoHelper,
         const ext::shared_ptr<LocalVolTermStructure>& leverageFct,
-        const Real mixingFactor)
+        const Real mixingFactor,
+        bool fourthOrderCompact)
     : correlationMap_(SecondOrderMixedDerivativeOp(0, 1, mesher)
                         .mult(hestonProcess->rho()*hestonProcess->sigma()
                                 *mixingFactor
@@ -142,7 +158,7 @@ namespace QuantLib {
       dxMap_(mesher,
              hestonProcess->riskFreeRate().currentLink(), 
              hestonProcess->dividendYield().currentLink(),
-             quantoHelper, leverageFct) {
+             quantoHelper, leverageFct, fourthOrderCompact) {
     }
 
 
@@ -156,14 +172,14 @@ namespace QuantLib {
     }
 
     Disposable<Array> FdmHestonOp::apply(const Array& u) const {
-        return dyMap_.getMap().apply(u) + dxMap_.getMap().apply(u)
+        return dyMap_.getMap().apply(u) + dxMap_.apply(u)
               + dxMap_.getL()*correlationMap_.apply(u);
     }
 
     Disposable<Array> FdmHestonOp::apply_direction(Size direction,
                                                    const Array& r) const {
         if (direction == 0)
-            return dxMap_.getMap().apply(r);
+            return dxMap_.apply(r);
         else if (direction == 1)
             return dyMap_.getMap().apply(r);
         else
@@ -179,7 +195,7 @@ namespace QuantLib {
                                      const Array& r, Real a) const {
 
         if (direction == 0) {
-            return dxMap_.getMap().solve_splitting(r, a, 1.0);
+            return dxMap_.solve_splitting(r, a);
         }
         else if (direction == 1) {
             return dyMap_.getMap().solve_splitting(r, a, 1.0);
@@ -197,6 +213,10 @@ namespace QuantLib {
 #if !defined(QL_NO_UBLAS_SUPPORT)
     Disposable<std::vector<SparseMatrix> >
     FdmHestonOp::toMatrixDecomp() const {
+        QL_REQUIRE(!dxMap_.isFourthOrderCompact(),
+                   "matrix representation is not available "
+                   "for the fourth-order compact operator");
+
         std::vector<SparseMatrix> retVal(3);
 
         retVal[0] = dxMap_.getMap().toMatrix();
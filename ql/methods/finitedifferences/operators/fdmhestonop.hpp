@@ -29,6 +29,7 @@
 
 #include <ql/processes/hestonprocess.hpp>
 #include <ql/methods/finitedifferences/utilities/fdmquantohelper.hpp>
+#include <ql/methods/finitedifferences/operators/compactconvectiondiffusionop.hpp>
 #include <ql/methods/finitedifferences/operators/firstderivativeop.hpp>
 #include <ql/methods/finitedifferences/operators/triplebandlinearop.hpp>
 #include <ql/methods/finitedifferences/operators/ninepointlinearop.hpp>
@@ -44,12 +45,17 @@ namespace QuantLib {
                             ext::shared_ptr<YieldTermStructure> qTS,
                             ext::shared_ptr<FdmQuantoHelper> quantoHelper,
                             ext::shared_ptr<LocalVolTermStructure> leverageFct =
-                                ext::shared_ptr<LocalVolTermStructure>());
+                                ext::shared_ptr<LocalVolTermStructure>(),
+                            bool fourthOrderCompact = false);
 
         void setTime(Time t1, Time t2);
         const TripleBandLinearOp& getMap() const;
         const Array& getL() const { return L_; }
 
+        Disposable<Array> apply(const Array& r) const;
+        Disposable<Array> solve_splitting(const Array& r, Real a) const;
+        bool isFourthOrderCompact() const { return compactMap_ != nullptr; }
+
       protected:
         Disposable<Array> getLeverageFctSlice(Time t1, Time t2) const;
 
@@ -62,6 +68,7 @@ namespace QuantLib {
         const ext::shared_ptr<YieldTermStructure> rTS_, qTS_;
         const ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
         const ext::shared_ptr<LocalVolTermStructure> leverageFct_;
+        const ext::shared_ptr<CompactConvectionDiffusionOp> compactMap_;
     };
 
     class FdmHestonVariancePart {
@@ -83,6 +90,11 @@ namespace QuantLib {
     };
 
 
+    /*! If fourthOrderCompact is set, the equity direction is
+        discretised using CompactConvectionDiffusionOp. The variance
+        direction and the correlation term keep the standard
+        second-order stencils.
+    */
     class FdmHestonOp : public FdmLinearOpComposite {
       public:
         FdmHestonOp(const ext::shared_ptr<FdmMesher>& mesher,
@@ -91,7 +103,8 @@ namespace QuantLib {
                         ext::shared_ptr<FdmQuantoHelper>(),
                     const ext::shared_ptr<LocalVolTermStructure>& leverageFct =
                         ext::shared_ptr<LocalVolTermStructure>(),
-                    Real mixingFactor = 1.0);
+                    Real mixingFactor = 1.0,
+                    bool fourthOrderCompact = false);
 
         Size size() const override;
         void setTime(Time t1, Time t2) override;
@@ -68,6 +68,24 @@ namespace QuantLib {
                                       spacing_.begin(), Size(0));
         }
 
+        /*! \name Line traversal
+            The grid decomposes into size()/dim()[direction] lines
+            along each direction. The nodes of a line have the indices
+            lineStart(direction, n) + k*spacing()[direction] with
+            k = 0,...,dim()[direction]-1, which allows for tight loops
+            without updating the coordinates of an iterator.
+        */
+        //@{
+        Size numberOfLines(Size direction) const {
+            return size_/dim_[direction];
+        }
+
+        Size lineStart(Size direction, Size n) const {
+            const Size s = spacing_[direction];
+            return (n % s) + (n / s)*s*dim_[direction];
+        }
+        //@}
+
         Size neighbourhood(const FdmLinearOpIterator& iterator,
                            Size i, Integer offset) const;
 
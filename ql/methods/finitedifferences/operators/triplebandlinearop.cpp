@@ -40,24 +40,36 @@ namespace QuantLib {
       mesher_(mesher) {
 
         const ext::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
-        const FdmLinearOpIterator endIter = layout->end();
+        const std::vector<Size>& dim = layout->dim();
+        const std::vector<Size>& spacing = layout->spacing();
 
-        std::vector<Size> newDim(layout->dim());
+        std::vector<Size> newDim(dim);
         std::iter_swap(newDim.begin(), newDim.begin()+direction_);
         std::vector<Size> newSpacing = FdmLinearOpLayout(newDim).spacing();
         std::iter_swap(newSpacing.begin(), newSpacing.begin()+direction_);
 
-        for (FdmLinearOpIterator iter = layout->begin(); iter!=endIter; ++iter) {
-            const Size i = iter.index();
+        const Size n = dim[direction_];
+        const Size stride = spacing[direction_];
+        const Size newStride = newSpacing[direction_];
 
-            i0_[i] = layout->neighbourhood(iter, direction, -1);
-            i2_[i] = layout->neighbourhood(iter, direction,  1);
+        // walk along the lines in the given direction, the neighbours
+        // on the boundaries are mirrored as in FdmLinearOpLayout
+        for (Size l=0; l < layout->numberOfLines(direction_); ++l) {
+            const Size start = layout->lineStart(direction_, l);
 
-            const std::vector<Size>& coordinates = iter.coordinates();
-            const Size newIndex =
-                  std::inner_product(coordinates.begin(), coordinates.end(),
-                                     newSpacing.begin(), Size(0));
-            reverseIndex_[newIndex] = i;
+            Size newStart = 0;
+            for (Size j=0; j < dim.size(); ++j)
+                newStart += ((start / spacing[j]) % dim[j])*newSpacing[j];
+
+            for (Size k=0; k < n; ++k) {
+                const Size i = start + k*stride;
+                const Size km = (k > 0)   ? k-1 : std::min(Size(1), n-1);
+                const Size kp = (k+1 < n) ? k+1 : ((n > 1) ? n-2 : 0);
+
+                i0_[i] = start + km*stride;
+                i2_[i] = start + kp*stride;
+                reverseIndex_[newStart + k*newStride] = i;
+            }
         }
     }
 
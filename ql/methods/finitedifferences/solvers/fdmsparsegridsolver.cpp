@@ -0,0 +1,228 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmsparsegridsolver.cpp
+*/
+
+#include <ql/methods/finitedifferences/meshers/fdmmesher.hpp>
+#include <ql/methods/finitedifferences/operators/fdmlinearopcomposite.hpp>
+#include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
+#include <ql/methods/finitedifferences/solvers/fdmsparsegridsolver.hpp>
+#include <ql/methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
+#include <ql/methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace QuantLib {
+
+    namespace {
+        // all vectors of the given size with non-negative entries
+        // summing up to m
+        void compositions(Size m, Size d, std::vector<Size>& current,
+                          std::vector<std::vector<Size> >& result) {
+            if (current.size() == d-1) {
+                current.push_back(m);
+                result.push_back(current);
+                current.pop_back();
+            }
+            else {
+                for (Size i=0; i <= m; ++i) {
+                    current.push_back(i);
+                    compositions(m-i, d, current, result);
+                    current.pop_back();
+                }
+            }
+        }
+
+        Real binomial(Size n, Size k) {
+            Real retVal = 1.0;
+            for (Size i=1; i <= k; ++i)
+                retVal *= Real(n-k+i)/i;
+            return retVal;
+        }
+    }
+
+    FdmSparseGridSolver::FdmSparseGridSolver(
+        std::vector<Size> minLevels,
+        Size level,
+        SolverDescFactory solverDescFactory,
+        OperatorFactory operatorFactory,
+        const FdmSchemeDesc& schemeDesc)
+    : minLevels_(std::move(minLevels)), level_(level),
+      solverDescFactory_(std::move(solverDescFactory)),
+      operatorFactory_(std::move(operatorFactory)),
+      schemeDesc_(schemeDesc) {
+
+        const Size d = minLevels_.size();
+        QL_REQUIRE(d > 0, "at least one dimension is required");
+        QL_REQUIRE(level_+1 >= d,
+                   "sparse grid level (" << level_ << ") must be at least "
+                   "the number of dimensions minus one (" << d-1 << ")");
+
+        for (Size q=0; q < d; ++q) {
+            std::vector<std::vector<Size> > levels;
+            std::vector<Size> current;
+            compositions(level_-q, d, current, levels);
+
+            const Real coefficient =
+                ((q % 2 == 0) ? 1.0 : -1.0)*binomial(d-1, q);
+
+            for (const auto& l: levels) {
+                ComponentGrid grid;
+                grid.coefficient = coefficient;
+                grid.dim.resize(d);
+                for (Size i=0; i < d; ++i)
+                    grid.dim[i] = (Size(1) << (l[i] + minLevels_[i])) + 1;
+
+                grids_.push_back(grid);
+            }
+        }
+    }
+
+    Size FdmSparseGridSolver::numberOfGrids() const {
+        return grids_.size();
+    }
+
+    Size FdmSparseGridSolver::numberOfGridPoints() const {
+        Size n = 0;
+        for (const auto& grid: grids_) {
+            Size m = 1;
+            for (Size dim : grid.dim)
+                m *= dim;
+            n += m;
+        }
+        return n;
+    }
+
+    void FdmSparseGridSolver::performCalculations() const {
+        const Size nGrids = grids_.size();
+
+        std::vector<FdmSolverDesc> descs;
+        std::vector<ext::shared_ptr<FdmLinearOpComposite> > ops;
+        descs.reserve(nGrids);
+        ops.reserve(nGrids);
+
+        std::vector<Array> rhs(nGrids);
+        for (Size i=0; i < nGrids; ++i) {
+            ComponentGrid& grid = grids_[i];
+
+            descs.push_back(solverDescFactory_(grid.dim));
+            const FdmSolverDesc& desc = descs.back();
+            const ext::shared_ptr<FdmMesher> mesher = desc.mesher;
+            const ext::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
+
+            QL_REQUIRE(layout->dim() == grid.dim,
+                       "mesher does not fit to the requested grid");
+
+            ops.push_back(operatorFactory_(mesher));
+            // triggers lazy calculations outside of the parallel section
+            ops.back()->setTime(0.0, desc.maturity);
+
+            const Size d = grid.dim.size();
+            grid.x.assign(d, std::vector<Real>());
+
+            rhs[i] = Array(layout->size());
+            const FdmLinearOpIterator endIter = layout->end();
+            for (FdmLinearOpIterator iter = layout->begin(); iter != endIter;
+                 ++iter) {
+                rhs[i][iter.index()] =
+                    desc.calculator->avgInnerValue(iter, desc.maturity);
+
+                const std::vector<Size>& c = iter.coordinates();
+                const Size sum = std::accumulate(c.begin(), c.end(), Size(0));
+                for (Size j=0; j < d; ++j) {
+                    if (sum == c[j])
+                        grid.x[j].push_back(mesher->location(iter, j));
+                }
+            }
+        }
+
+        std::string error;
+
+        #pragma omp parallel for schedule(dynamic)
+        for (long i=0; i < (long)nGrids; ++i) {
+            try {
+                const FdmSolverDesc& desc = descs[i];
+
+                FdmBackwardSolver(ops[i], desc.bcSet, desc.condition,
+                                  schemeDesc_)
+                    .rollback(rhs[i], desc.maturity, 0.0,
+                              desc.timeSteps, desc.dampingSteps);
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+        }
+        QL_REQUIRE(error.empty(), error);
+
+        for (Size i=0; i < nGrids; ++i)
+            grids_[i].values = rhs[i];
+    }
+
+    Real FdmSparseGridSolver::interpolate(const ComponentGrid& grid,
+                                          const std::vector<Real>& x) const {
+        const Size d = grid.dim.size();
+
+        std::vector<Size> idx(d);
+        std::vector<Real> w(d);
+        for (Size i=0; i < d; ++i) {
+            const std::vector<Real>& xi = grid.x[i];
+            const Real y = std::min(xi.back(), std::max(xi.front(), x[i]));
+
+            idx[i] = std::min(Size(std::upper_bound(xi.begin(), xi.end(), y)
+                                   - xi.begin()), xi.size()-1) - 1;
+            w[i] = (y - xi[idx[i]])/(xi[idx[i]+1] - xi[idx[i]]);
+        }
+
+        Real retVal = 0.0;
+        for (Size corner=0; corner < (Size(1) << d); ++corner) {
+            Real weight = 1.0;
+            Size index = 0, stride = 1;
+            for (Size i=0; i < d; ++i) {
+                const Size bit = (corner >> i) & 1U;
+                weight *= (bit != 0U) ? w[i] : 1.0-w[i];
+                index += (idx[i] + bit)*stride;
+                stride *= grid.dim[i];
+            }
+            if (weight != 0.0)
+                retVal += weight*grid.values[index];
+        }
+
+        return retVal;
+    }
+
+    Real FdmSparseGridSolver::interpolateAt(const std::vector<Real>& x) const {
+        QL_REQUIRE(x.size() == minLevels_.size(),
+                   "point dimension " << x.size() << " does not fit to "
+                   "grid dimension " << minLevels_.size());
+
+        calculate();
+
+        Real retVal = 0.0;
+        for (const auto& grid: grids_)
+            retVal += grid.coefficient*interpolate(grid, x);
+
+        return retVal;
+    }
+}
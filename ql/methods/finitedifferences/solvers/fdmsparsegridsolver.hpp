@@ -0,0 +1,120 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmsparsegridsolver.hpp
+    \brief sparse grid combination technique for multi-dimensional PDEs
+*/
+
+#ifndef quantlib_fdm_sparse_grid_solver_hpp
+#define quantlib_fdm_sparse_grid_solver_hpp
+
+#include <ql/functional.hpp>
+#include <ql/patterns/lazyobject.hpp>
+#include <ql/methods/finitedifferences/solvers/fdmsolverdesc.hpp>
+#include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+
+namespace QuantLib {
+
+    class FdmLinearOpComposite;
+
+    //! sparse grid combination technique
+    /*! The solution on a sparse grid of level \f$ n \f$ is approximated
+        by a linear combination of solutions on anisotropic full grids,
+        \f[
+            u_n = \sum_{q=0}^{d-1} (-1)^q \binom{d-1}{q}
+                  \sum_{|l|_1 = n-q} u_l,
+        \f]
+        where the component grid \f$ l \f$ has \f$ 2^{l_i+m_i}+1 \f$
+        points in direction \f$ i \f$ and \f$ m_i \f$ is the minimum
+        level of the direction. The number of grid points grows like
+        \f$ O(2^n n^{d-1}) \f$ instead of \f$ O(2^{nd}) \f$ for the
+        full grid, which makes four to six dimensional problems
+        feasible.
+
+        The component problems are independent of each other and are
+        rolled back using the standard FdmBackwardSolver. If OpenMP is
+        enabled the component grids are solved in parallel. The
+        operators are set up before the parallel section, the rollback
+        itself must not trigger lazy recalculations or write to
+        caches of shared objects.
+
+        The solution of each component grid is interpolated
+        multi-linearly; the result is the combination of these
+        interpolations.
+
+        \warning The combination technique requires a smooth solution
+                 with bounded mixed derivatives. Non-smooth payoffs
+                 should be aligned with the grid directions.
+    */
+    class FdmSparseGridSolver : public LazyObject {
+      public:
+        typedef ext::function<FdmSolverDesc(const std::vector<Size>&)>
+            SolverDescFactory;
+        typedef ext::function<ext::shared_ptr<FdmLinearOpComposite>(
+            const ext::shared_ptr<FdmMesher>&)> OperatorFactory;
+
+        /*! \param minLevels     minimum level per direction, a component
+                                 grid has at least 2^minLevel+1 points in
+                                 this direction.
+            \param level         level of the sparse grid, at least
+                                 the number of dimensions minus one
+            \param solverDescFactory returns the solver description for
+                                 the given number of grid points per
+                                 direction.
+            \param operatorFactory   returns the operator for the given
+                                 mesher.
+        */
+        FdmSparseGridSolver(std::vector<Size> minLevels,
+                            Size level,
+                            SolverDescFactory solverDescFactory,
+                            OperatorFactory operatorFactory,
+                            const FdmSchemeDesc& schemeDesc
+                                = FdmSchemeDesc::Douglas());
+
+        Real interpolateAt(const std::vector<Real>& x) const;
+
+        Size numberOfGrids() const;
+        //! total number of grid points of all component grids
+        Size numberOfGridPoints() const;
+
+      protected:
+        void performCalculations() const override;
+
+      private:
+        struct ComponentGrid {
+            std::vector<Size> dim;
+            Real coefficient;
+            std::vector<std::vector<Real> > x;
+            Array values;
+        };
+
+        Real interpolate(const ComponentGrid& grid,
+                         const std::vector<Real>& x) const;
+
+        const std::vector<Size> minLevels_;
+        const Size level_;
+        const SolverDescFactory solverDescFactory_;
+        const OperatorFactory operatorFactory_;
+        const FdmSchemeDesc schemeDesc_;
+
+        mutable std::vector<ComponentGrid> grids_;
+    };
+}
+
+#endif
@@ -28,28 +28,12 @@ namespace QuantLib {
         const ext::shared_ptr<FdmLinearOpLayout>& layout,
         Size direction, FdmDirichletBoundary::Side side) {
 
-        std::vector<Size> newDim(layout->dim());
-        newDim[direction] = 1;
-        const Size hyperSize
-            = std::accumulate(newDim.begin(), newDim.end(), Size(1),
-                              std::multiplies<Size>());
-        indices_.resize(hyperSize);
-
-        Size i=0;
-        const FdmLinearOpIterator endIter = layout->end();
-        for (FdmLinearOpIterator iter = layout->begin(); iter != endIter;
-            ++iter) {
-            if (   (   side == FdmDirichletBoundary::Lower
-                    && iter.coordinates()[direction] == 0)
-                || (   side == FdmDirichletBoundary::Upper
-                    && iter.coordinates()[direction]
-                                            == layout->dim()[direction]-1)) {
-                QL_REQUIRE(hyperSize > i, "index missmatch");
-                indices_[i++] = iter.index();
-            }
-        }
-
+        const Size offset = (side == FdmDirichletBoundary::Upper)
+            ? (layout->dim()[direction]-1)*layout->spacing()[direction] : 0;
 
+        indices_.resize(layout->numberOfLines(direction));
+        for (Size i=0; i < indices_.size(); ++i)
+            indices_[i] = layout->lineStart(direction, i) + offset;
     }
 
     const std::vector<Size>& FdmIndicesOnBoundary::getIndices() const {
@@ -0,0 +1,81 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/methods/finitedifferences/utilities/fdmmeshercache.hpp>
+#include <functional>
+#include <utility>
+
+namespace QuantLib {
+
+    FdmMesherCache::Key::Key(MesherType type,
+                             std::vector<ext::shared_ptr<const Observable> > sources,
+                             std::vector<Real> parameters)
+    : type_(type), sources_(std::move(sources)),
+      parameters_(std::move(parameters)) {}
+
+    bool FdmMesherCache::Key::operator<(const Key& other) const {
+        if (type_ != other.type_)
+            return type_ < other.type_;
+        if (sources_.size() != other.sources_.size())
+            return sources_.size() < other.sources_.size();
+        for (Size i=0; i < sources_.size(); ++i) {
+            if (sources_[i].get() != other.sources_[i].get())
+                return std::less<const Observable*>()(
+                    sources_[i].get(), other.sources_[i].get());
+        }
+        return parameters_ < other.parameters_;
+    }
+
+    FdmMesherCache::FdmMesherCache(Size maxSize)
+    : maxSize_(maxSize), hits_(0), misses_(0) {
+        QL_REQUIRE(maxSize_ > 0, "cache size must be positive");
+    }
+
+    ext::shared_ptr<Fdm1dMesher> FdmMesherCache::mesher(
+        const Key& key,
+        const ext::function<ext::shared_ptr<Fdm1dMesher>()>& factory) {
+
+        const auto iter = meshers_.find(key);
+        if (iter != meshers_.end()) {
+            ++hits_;
+            return iter->second;
+        }
+
+        ++misses_;
+        const ext::shared_ptr<Fdm1dMesher> m = factory();
+
+        if (meshers_.size() == maxSize_) {
+            meshers_.erase(insertionOrder_.front());
+            insertionOrder_.pop_front();
+        }
+        meshers_[key] = m;
+        insertionOrder_.push_back(key);
+
+        return m;
+    }
+
+    void FdmMesherCache::clear() {
+        meshers_.clear();
+        insertionOrder_.clear();
+    }
+
+    void FdmMesherCache::update() {
+        clear();
+    }
+}
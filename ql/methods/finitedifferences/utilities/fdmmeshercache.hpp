@@ -0,0 +1,95 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmmeshercache.hpp
+    \brief cache for one-dimensional meshers shared between engine calls
+*/
+
+#ifndef quantlib_fdm_mesher_cache_hpp
+#define quantlib_fdm_mesher_cache_hpp
+
+#include <ql/functional.hpp>
+#include <ql/patterns/observable.hpp>
+#include <ql/methods/finitedifferences/meshers/fdm1dmesher.hpp>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace QuantLib {
+
+    //! cache for one-dimensional meshers
+    /*! Meshers like FdmHestonVarianceMesher or FdmBlackScholesMesher
+        integrate densities or evaluate volatility surfaces during
+        construction. Pricing many options on the same model rebuilds
+        the same meshers over and over again; the cache keeps them
+        keyed by the mesher type, by the identity of the objects the
+        mesher was built from (process, model, leverage function,
+        quanto helper) and by the grid parameters. The keys hold
+        shared pointers to these objects, therefore their addresses
+        cannot be reused by other objects while the entry is cached.
+
+        The cache must be registered with the observables the meshers
+        depend on. It is flushed whenever any of them notifies a
+        change.
+
+        \note operators are not cached. They hold time-dependent
+               coefficients which are rewritten by setTime() at every
+               time step, and building them is cheap compared to the
+               rollback itself.
+    */
+    class FdmMesherCache : public Observer {
+      public:
+        enum MesherType { BlackScholes, HestonVariance };
+
+        class Key {
+          public:
+            Key(MesherType type,
+                std::vector<ext::shared_ptr<const Observable> > sources,
+                std::vector<Real> parameters);
+
+            bool operator<(const Key& other) const;
+
+          private:
+            MesherType type_;
+            std::vector<ext::shared_ptr<const Observable> > sources_;
+            std::vector<Real> parameters_;
+        };
+
+        explicit FdmMesherCache(Size maxSize = 64);
+
+        ext::shared_ptr<Fdm1dMesher> mesher(
+            const Key& key,
+            const ext::function<ext::shared_ptr<Fdm1dMesher>()>& factory);
+
+        Size size() const { return meshers_.size(); }
+        Size hits() const { return hits_; }
+        Size misses() const { return misses_; }
+
+        void clear();
+        void update() override;
+
+      private:
+        const Size maxSize_;
+        Size hits_, misses_;
+        std::map<Key, ext::shared_ptr<Fdm1dMesher> > meshers_;
+        std::deque<Key> insertionOrder_;
+    };
+}
+
+#endif
@@ -156,7 +156,7 @@ namespace QuantLib {
             Array newValues(this->impl().size(i));
             this->impl().stepback(i, asset.values(), newValues);
             asset.time() = t_[i];
-            asset.values() = newValues;
+            asset.values().swap(newValues);
             // skip the very last adjustment
             if (i != iTo)
                 asset.adjustValues();
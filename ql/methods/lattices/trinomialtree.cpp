@@ -74,5 +74,26 @@ namespace QuantLib {
         }
     }
 
+    void TrinomialTree::Branching::expectedValues(const Array& values,
+                                                  Array& result) const {
+        QL_REQUIRE(result.size() == k_.size(),
+                   "result size (" << result.size()
+                   << ") does not match the number of nodes ("
+                   << k_.size() << ")");
+        const Real* v = values.begin();
+        const Integer offset = jMin_ + 1;
+        const Real* p0 = &probs_[0][0];
+        const Real* p1 = &probs_[1][0];
+        const Real* p2 = &probs_[2][0];
+        const Integer* k = &k_[0];
+        Real* r = result.begin();
+        // branch-free loop over contiguous data; the descendants of a
+        // node are the three consecutive nodes around k
+        for (Size j=0; j<k_.size(); j++) {
+            const Real* d = v + (k[j] - offset);
+            r[j] = p0[j]*d[0] + p1[j]*d[1] + p2[j]*d[2];
+        }
+    }
+
 }
 
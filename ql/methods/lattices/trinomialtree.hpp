@@ -25,6 +25,7 @@
 #ifndef quantlib_trinomial_tree_hpp
 #define quantlib_trinomial_tree_hpp
 
+#include <ql/math/array.hpp>
 #include <ql/methods/lattices/tree.hpp>
 #include <ql/timegrid.hpp>
 
@@ -53,6 +54,14 @@ namespace QuantLib {
         Size descendant(Size i, Size index, Size branch) const;
         Real probability(Size i, Size index, Size branch) const;
 
+        //! expected values at step i of the given values at step i+1
+        /*! This is equivalent to summing probability() times the value
+            at descendant() over the three branches for each node, but
+            it runs over the contiguous branching data of the step. */
+        void expectedValues(Size i,
+                            const Array& values,
+                            Array& result) const;
+
       protected:
         std::vector<Branching> branchings_;
         Real x0_;
@@ -72,6 +81,7 @@ namespace QuantLib {
             Integer jMin() const;
             Integer jMax() const;
             void add(Integer k, Real p1, Real p2, Real p3);
+            void expectedValues(const Array& values, Array& result) const;
           private:
             std::vector<Integer> k_;
             std::vector<std::vector<Real> > probs_;
@@ -102,6 +112,12 @@ namespace QuantLib {
         return branchings_[i].probability(j, b);
     }
 
+    inline void TrinomialTree::expectedValues(Size i,
+                                              const Array& values,
+                                              Array& result) const {
+        branchings_[i].expectedValues(values, result);
+    }
+
     inline TrinomialTree::Branching::Branching()
     : probs_(3), kMin_(QL_MAX_INTEGER), jMin_(QL_MAX_INTEGER),
                  kMax_(QL_MIN_INTEGER), jMax_(QL_MIN_INTEGER) {}
@@ -36,6 +36,7 @@
 #if !defined(QL_USE_STD_UNIQUE_PTR)
 #include <boost/scoped_array.hpp>
 #endif
+#include <algorithm>
 #include <utility>
 #include <memory>
 
@@ -48,6 +49,14 @@ namespace QuantLib {
         by Simulation: A Simple Least-Squares Approach, The Review of
         Financial Studies, Volume 14, No. 1, 113-147
 
+        During the calibration phase, only the exercise values and
+        the regression states at the exercise times are kept; they are
+        stored contiguously, path after path, instead of the full
+        calibration paths.  At each exercise time, the basis functions
+        are evaluated once per in-the-money path into a design matrix
+        which is used both for the regression and for the continuation
+        values.
+
         \ingroup mcarlo
 
         \test the correctness of the returned value is tested by
@@ -86,12 +95,45 @@ namespace QuantLib {
         boost::scoped_array<DiscountFactor> dF_;
         #endif
 
-        mutable std::vector<PathType> paths_;
+        // exercise values and flattened states at times 1..len_-1,
+        // stored path after path during calibration
+        mutable std::vector<Real> exercises_;
+        mutable std::vector<Real> states_;
+        mutable Size stateSize_;
+        mutable Size nCalibrationPaths_;
         const   std::vector<ext::function<Real(StateType)> > v_;
 
         const Size len_;
     };
 
+    namespace detail {
+
+        // flattening of the regression states for contiguous storage
+
+        inline Size lsmStateSize(Real) { return 1; }
+
+        inline Size lsmStateSize(const Array& state) { return state.size(); }
+
+        inline void lsmStoreState(Real state, std::vector<Real>& to) {
+            to.push_back(state);
+        }
+
+        inline void lsmStoreState(const Array& state, std::vector<Real>& to) {
+            to.insert(to.end(), state.begin(), state.end());
+        }
+
+        inline void lsmLoadState(const Real* from, Size, Real& state) {
+            state = *from;
+        }
+
+        inline void lsmLoadState(const Real* from, Size n, Array& state) {
+            if (state.size() != n)
+                state = Array(n);
+            std::copy(from, from + n, state.begin());
+        }
+
+    }
+
     template <class PathType>
     inline LongstaffSchwartzPathPricer<PathType>::LongstaffSchwartzPathPricer(
         const TimeGrid& times,
@@ -99,6 +141,7 @@ namespace QuantLib {
         const ext::shared_ptr<YieldTermStructure>& termStructure)
     : calibrationPhase_(true), pathPricer_(std::move(pathPricer)),
       coeff_(new Array[times.size() - 2]), dF_(new DiscountFactor[times.size() - 1]),
+      stateSize_(Null<Size>()), nCalibrationPaths_(0),
       v_(pathPricer_->basisSystem()), len_(times.size()) {
 
         for (Size i=0; i<times.size()-1; ++i) {
@@ -111,8 +154,19 @@ namespace QuantLib {
     Real LongstaffSchwartzPathPricer<PathType>::operator()
         (const PathType& path) const {
         if (calibrationPhase_) {
-            // store paths for the calibration
-            paths_.push_back(path);
+            // store the information needed by the calibration
+            for (Size i=1; i<len_; ++i) {
+                exercises_.push_back((*pathPricer_)(path, i));
+                const StateType state = pathPricer_->state(path, i);
+                if (stateSize_ == Null<Size>())
+                    stateSize_ = detail::lsmStateSize(state);
+                QL_REQUIRE(detail::lsmStateSize(state) == stateSize_,
+                           "inconsistent regression state size ("
+                           << detail::lsmStateSize(state) << ", "
+                           << stateSize_ << " expected)");
+                detail::lsmStoreState(state, states_);
+            }
+            ++nCalibrationPaths_;
             // result doesn't matter
             return 0.0;
         }
@@ -150,56 +204,72 @@ namespace QuantLib {
 
     template <class PathType> inline
     void LongstaffSchwartzPathPricer<PathType>::calibrate() {
-        const Size n = paths_.size();
+        const Size n = nCalibrationPaths_;
+        const Size m = len_-1;
+        const Size nBasis = v_.size();
         Array prices(n), exercise(n);
         std::vector<StateType> p_state(n);
         std::vector<Real> p_price(n), p_exercise(n);
 
-        for (Size i=0; i<n; ++i) {
-            p_state[i] = pathPricer_->state(paths_[i],len_-1);
-            prices[i] = p_price[i] = (*pathPricer_)(paths_[i], len_-1);
-            p_exercise[i] = prices[i];
+        for (Size j=0; j<n; ++j) {
+            detail::lsmLoadState(&states_[(j*m + m-1)*stateSize_],
+                                 stateSize_, p_state[j]);
+            prices[j] = p_price[j] = exercises_[j*m + m-1];
+            p_exercise[j] = prices[j];
         }
 
         post_processing(len_ - 1, p_state, p_price, p_exercise);
 
-        std::vector<Real>      y;
-        std::vector<StateType> x;
+        std::vector<Real> y;
+        std::vector<Size> itm;
+        y.reserve(n);
+        itm.reserve(n);
+        StateType state;
         for (Size i=len_-2; i>0; --i) {
             y.clear();
-            x.clear();
+            itm.clear();
 
             //roll back step
             for (Size j=0; j<n; ++j) {
-                exercise[j]=(*pathPricer_)(paths_[j], i);
+                exercise[j] = exercises_[j*m + i-1];
                 if (exercise[j]>0.0) {
-                    x.push_back(pathPricer_->state(paths_[j], i));
+                    itm.push_back(j);
                     y.push_back(dF_[i]*prices[j]);
                 }
             }
 
-            if (v_.size() <=  x.size()) {
-                coeff_[i-1] = GeneralLinearLeastSquares(x, y, v_).coefficients();
+            // basis functions at the itm states, evaluated only once
+            Matrix A(itm.size(), nBasis);
+            for (Size k=0; k<itm.size(); ++k) {
+                detail::lsmLoadState(&states_[(itm[k]*m + i-1)*stateSize_],
+                                     stateSize_, state);
+                for (Size l=0; l<nBasis; ++l)
+                    A[k][l] = v_[l](state);
+            }
+
+            if (nBasis <= itm.size()) {
+                coeff_[i-1] = GeneralLinearLeastSquares(A, y).coefficients();
             }
             else {
             // if number of itm paths is smaller then the number of
             // calibration functions then early exercise if exerciseValue > 0
-                coeff_[i-1] = Array(v_.size(), 0.0);
+                coeff_[i-1] = Array(nBasis, 0.0);
             }
 
             for (Size j=0, k=0; j<n; ++j) {
                 prices[j]*=dF_[i];
                 if (exercise[j]>0.0) {
                     Real continuationValue = 0.0;
-                    for (Size l=0; l<v_.size(); ++l) {
-                        continuationValue += coeff_[i-1][l] * v_[l](x[k]);
+                    for (Size l=0; l<nBasis; ++l) {
+                        continuationValue += coeff_[i-1][l] * A[k][l];
                     }
                     if (continuationValue < exercise[j]) {
                         prices[j] = exercise[j];
                     }
                     ++k;
                 }
-                p_state[j] = pathPricer_->state(paths_[j],i);
+                detail::lsmLoadState(&states_[(j*m + i-1)*stateSize_],
+                                     stateSize_, p_state[j]);
                 p_price[j] = prices[j];
                 p_exercise[j] = exercise[j];
             }
@@ -207,9 +277,11 @@ namespace QuantLib {
             post_processing(i, p_state, p_price, p_exercise);
         }
 
-        // remove calibration paths and release memory
-        std::vector<PathType> empty;
-        paths_.swap(empty);
+        // remove calibration data and release memory
+        std::vector<Real>().swap(exercises_);
+        std::vector<Real>().swap(states_);
+        stateSize_ = Null<Size>();
+        nCalibrationPaths_ = 0;
         // entering the calculation phase
         calibrationPhase_ = false;
     }
@@ -23,6 +23,7 @@
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/models/marketmodels/evolver.hpp>
 #include <algorithm>
+#include <string>
 #include <utility>
 
 namespace QuantLib {
@@ -119,4 +120,56 @@ namespace QuantLib {
         }
     }
 
+
+    ParallelAccountingEngine::ParallelAccountingEngine(
+                const std::vector<ext::shared_ptr<MarketModelEvolver> >& evolvers,
+                const Clone<MarketModelMultiProduct>& product,
+                Real initialNumeraireValue)
+    : numberProducts_(product->numberOfProducts()) {
+        QL_REQUIRE(!evolvers.empty(), "no evolvers given");
+        engines_.reserve(evolvers.size());
+        for (const auto& evolver : evolvers) {
+            QL_REQUIRE(evolver, "null evolver given");
+            // each engine holds its own clone of the product
+            engines_.emplace_back(evolver, product, initialNumeraireValue);
+        }
+    }
+
+    void ParallelAccountingEngine::multiplePathValues(
+                                              SequenceStatisticsInc& stats,
+                                              Size numberOfPaths) {
+        const Size n = engines_.size();
+        const Size blockSize = pathBlockSize;
+        std::vector<std::vector<Real> > values(
+            std::min(blockSize, numberOfPaths),
+            std::vector<Real>(numberProducts_));
+        std::vector<Real> weights(values.size());
+
+        for (Size first=0; first<numberOfPaths; first+=blockSize) {
+            const Size size = std::min(blockSize, numberOfPaths-first);
+            std::string error;
+
+            #pragma omp parallel for
+            for (long k=0; k<long(n); ++k) {
+                try {
+                    // engine k generates the paths i of this block with
+                    // i % n == k, in increasing order
+                    Size j = (k + n - first % n) % n;
+                    for (; j<size; j+=n)
+                        weights[j] = engines_[k].singlePathValues(values[j]);
+                } catch (std::exception& e) {
+                    #pragma omp critical
+                    {
+                        if (error.empty())
+                            error = e.what();
+                    }
+                }
+            }
+            QL_REQUIRE(error.empty(), error);
+
+            for (Size j=0; j<size; ++j)
+                stats.add(values[j], weights[j]);
+        }
+    }
+
 }
@@ -49,6 +49,7 @@ namespace QuantLib {
         void multiplePathValues(SequenceStatisticsInc& stats,
                                 Size numberOfPaths);
       private:
+        friend class ParallelAccountingEngine;
         Real singlePathValues(std::vector<Real>& values);
 
         ext::shared_ptr<MarketModelEvolver> evolver_;
@@ -66,6 +67,36 @@ namespace QuantLib {
 
     };
 
+    //! Accounting engine running several evolvers concurrently
+    /*! Each evolver drives its own AccountingEngine, holding its own
+        copy of the product; the engines are run concurrently (when
+        OpenMP is enabled) on blocks of paths, and the resulting path
+        values are added to the statistics in path order.  Path \f$ i
+        \f$ is generated by evolver \f$ i \bmod n \f$, so results
+        depend on the number of evolvers but not on the number of
+        threads; with a single evolver they coincide with those of
+        AccountingEngine.
+
+        \warning the evolvers must not share their Brownian generators,
+                 and should draw from independent streams (e.g., from
+                 generator factories with different seeds) for the
+                 paths to be independent.
+    */
+    class ParallelAccountingEngine {
+      public:
+        ParallelAccountingEngine(
+                const std::vector<ext::shared_ptr<MarketModelEvolver> >& evolvers,
+                const Clone<MarketModelMultiProduct>& product,
+                Real initialNumeraireValue);
+        void multiplePathValues(SequenceStatisticsInc& stats,
+                                Size numberOfPaths);
+        //! number of paths generated between two statistics updates
+        static const Size pathBlockSize = 1024;
+      private:
+        std::vector<AccountingEngine> engines_;
+        Size numberProducts_;
+    };
+
 }
 
 #endif
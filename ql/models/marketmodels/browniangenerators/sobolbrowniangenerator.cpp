@@ -19,6 +19,8 @@
 
 #include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
 #include <boost/iterator/permutation_iterator.hpp>
+#include <algorithm>
+#include <string>
 
 namespace QuantLib {
 
@@ -114,11 +116,13 @@ namespace QuantLib {
                                         unsigned long seed,
                                         SobolRsg::DirectionIntegers integers)
     : factors_(factors), steps_(steps), ordering_(ordering),
-      generator_(SobolRsg(factors*steps, seed, integers),
-                 InverseCumulativeNormal()),
+      generator_(factors*steps, seed, integers),
       bridge_(steps), lastStep_(0),
       orderedIndices_(factors, std::vector<Size>(steps)),
-      bridgedVariates_(factors, std::vector<Real>(steps)) {
+      currentPath_(0), nextPathInBlock_(pathBlockSize),
+      variates_(pathBlockSize*factors*steps),
+      bridgedVariates_(pathBlockSize*factors*steps),
+      weights_(pathBlockSize) {
 
         switch (ordering_) {
           case Factors:
@@ -136,24 +140,74 @@ namespace QuantLib {
     }
 
 
-    Real SobolBrownianGenerator::nextPath() {
-        typedef InverseCumulativeRsg<SobolRsg,
-                                     InverseCumulativeNormal>::sample_type
-            sample_type;
-
-        const sample_type& sample = generator_.nextSequence();
-        // Brownian-bridge the variates according to the ordered indices
-        for (Size i=0; i<factors_; ++i) {
-            bridge_.transform(boost::make_permutation_iterator(
-                                                  sample.value.begin(),
+    void SobolBrownianGenerator::generateBlock() {
+        const Size dim = factors_*steps_;
+        const Size blockSize = pathBlockSize;
+
+        // the Sobol points must be drawn in sequence...
+        for (Size p=0; p<blockSize; ++p) {
+            const SobolRsg::sample_type& sample = generator_.nextSequence();
+            std::copy(sample.value.begin(), sample.value.end(),
+                      variates_.begin() + p*dim);
+            weights_[p] = sample.weight;
+        }
+
+        // ...while inverting and bridging them can be done path by path
+        std::string error;
+        #pragma omp parallel for
+        for (long p=0; p<long(blockSize); ++p) {
+            try {
+                std::vector<Real>::iterator sample =
+                    variates_.begin() + p*dim;
+                std::vector<Real>::iterator output =
+                    bridgedVariates_.begin() + p*dim;
+                for (Size k=0; k<dim; ++k)
+                    sample[k] = inverseCumulative_(sample[k]);
+                // Brownian-bridge the variates according to the
+                // ordered indices
+                for (Size i=0; i<factors_; ++i) {
+                    bridge_.transform(boost::make_permutation_iterator(
+                                                  sample,
                                                   orderedIndices_[i].begin()),
-                              boost::make_permutation_iterator(
-                                                  sample.value.begin(),
+                                      boost::make_permutation_iterator(
+                                                  sample,
                                                   orderedIndices_[i].end()),
-                              bridgedVariates_[i].begin());
+                                      output + i*steps_);
+                }
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
         }
+        QL_REQUIRE(error.empty(), error);
+
+        nextPathInBlock_ = 0;
+    }
+
+    Real SobolBrownianGenerator::nextPath() {
+        if (nextPathInBlock_ == pathBlockSize)
+            generateBlock();
+        currentPath_ = nextPathInBlock_++;
         lastStep_ = 0;
-        return sample.weight;
+        return weights_[currentPath_];
+    }
+
+    void SobolBrownianGenerator::nextPaths(Size paths,
+                                           std::vector<Real>& variates,
+                                           std::vector<Real>& weights) {
+        const Size dim = factors_*steps_;
+        variates.resize(paths*dim);
+        weights.resize(paths);
+        for (Size p=0; p<paths; ++p) {
+            weights[p] = nextPath();
+            std::vector<Real>::const_iterator path =
+                bridgedVariates_.begin() + currentPath_*dim;
+            std::copy(path, path + dim, variates.begin() + p*dim);
+        }
+        lastStep_ = steps_;
     }
     
     
@@ -198,8 +252,10 @@ namespace QuantLib {
         QL_REQUIRE(output.size() == factors_, "size mismatch");
         QL_REQUIRE(lastStep_<steps_, "sequence exhausted");
         #endif
+        std::vector<Real>::const_iterator path =
+            bridgedVariates_.begin() + currentPath_*factors_*steps_;
         for (Size i=0; i<factors_; ++i)
-            output[i] = bridgedVariates_[i][lastStep_];
+            output[i] = path[i*steps_ + lastStep_];
         ++lastStep_;
         return 1.0;
     }
@@ -22,7 +22,6 @@
 #define quantlib_sobol_brownian_generator_hpp
 
 #include <ql/models/marketmodels/browniangenerator.hpp>
-#include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/methods/montecarlo/brownianbridge.hpp>
 #include <ql/math/distributions/normaldistribution.hpp>
@@ -33,6 +32,12 @@ namespace QuantLib {
     //! Sobol Brownian generator for market-model simulations
     /*! Incremental Brownian generator using a Sobol generator,
         inverse-cumulative Gaussian method, and Brownian bridging.
+
+        Paths are generated in blocks of pathBlockSize: the Sobol
+        points are drawn in sequence, while their inversion and
+        bridging, which are independent across paths, are run
+        concurrently when OpenMP is enabled.  The sequence of paths
+        returned is the same as when generating them one at a time.
     */
     class SobolBrownianGenerator : public BrownianGenerator {
       public:
@@ -60,20 +65,38 @@ namespace QuantLib {
         Size numberOfFactors() const override;
         Size numberOfSteps() const override;
 
+        /*! Generates the next \p paths paths in a single call.  On
+            exit, \p variates holds paths*factors*steps values ordered
+            by path, then by factor, then by step; \p weights holds the
+            path weights.  The generator moves past the returned paths
+            as if nextPath() had been called for each of them.
+        */
+        void nextPaths(Size paths,
+                       std::vector<Real>& variates,
+                       std::vector<Real>& weights);
+
+        //! number of paths generated at a time
+        static const Size pathBlockSize = 64;
+
         // test interface
         const std::vector<std::vector<Size> >& orderedIndices() const;
         std::vector<std::vector<Real> > transform(
                               const std::vector<std::vector<Real> >& variates);
 
       private:
+        void generateBlock();
         Size factors_, steps_;
         Ordering ordering_;
-        InverseCumulativeRsg<SobolRsg,InverseCumulativeNormal> generator_;
+        SobolRsg generator_;
+        InverseCumulativeNormal inverseCumulative_;
         BrownianBridge bridge_;
         // work variables
         Size lastStep_;
         std::vector<std::vector<Size> > orderedIndices_;
-        std::vector<std::vector<Real> > bridgedVariates_;
+        // current block of paths; the variates are stored path by path
+        // and, within each path, factor by factor
+        Size currentPath_, nextPathInBlock_;
+        std::vector<Real> variates_, bridgedVariates_, weights_;
     };
 
     class SobolBrownianGeneratorFactory : public BrownianGeneratorFactory {
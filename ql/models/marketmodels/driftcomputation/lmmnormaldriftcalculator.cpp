@@ -19,6 +19,7 @@
 */
 
 #include <ql/models/marketmodels/driftcomputation/lmmnormaldriftcalculator.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -29,7 +30,7 @@ namespace QuantLib {
     : numberOfRates_(taus.size()), numberOfFactors_(pseudo.columns()),
       isFullFactor_(numberOfFactors_ == numberOfRates_), numeraire_(numeraire), alive_(alive),
       oneOverTaus_(taus.size()), pseudo_(pseudo), tmp_(taus.size(), 0.0),
-      e_(pseudo_.columns(), pseudo_.rows(), 0.0), downs_(taus.size()), ups_(taus.size()) {
+      e_(pseudo_.rows(), pseudo_.columns(), 0.0), downs_(taus.size()), ups_(taus.size()) {
 
         // Check requirements
         QL_REQUIRE(numberOfRates_>0, "Dim out of range");
@@ -115,9 +116,11 @@ namespace QuantLib {
         for (Size i=alive_; i<numberOfRates_; ++i)
             tmp_[i] = 1.0/(oneOverTaus_[i]+forwards[i]);
 
-        // Enforce initialization
-        for (Size r=0; r<numberOfFactors_; ++r)
-            e_[r][std::max(0,static_cast<Integer>(numeraire_)-1)] = 0.0;
+        // Enforce initialization; e_ is stored rate by rate, so that the
+        // loops over factors below run on contiguous memory.
+        std::fill(e_.row_begin(std::max(0,static_cast<Integer>(numeraire_)-1)),
+                  e_.row_end(std::max(0,static_cast<Integer>(numeraire_)-1)),
+                  0.0);
 
         // Now compute drifts: take the numeraire P_N (numeraire_=N)
         // as the reference point, divide the summation into 3 steps,
@@ -129,29 +132,44 @@ namespace QuantLib {
 
         // 2nd step: then, move backward from N-2 (included) back to
         // alive (included) (if N=0 jumps to 3rd step, if N=numberOfRates_ the
-        // e_[r][N-1] are correctly initialized):
+        // e_[N-1][r] are correctly initialized):
 
         for (Integer i=static_cast<Integer>(numeraire_)-2;
              i>=static_cast<Integer>(alive_); --i) {
-            drifts[i] = 0.0;
+            Matrix::row_iterator ei = e_.row_begin(i);
+            Matrix::const_row_iterator ei1 = e_.row_begin(i+1);
+            Matrix::const_row_iterator pi = pseudo_.row_begin(i);
+            Matrix::const_row_iterator pi1 = pseudo_.row_begin(i+1);
+            const Real x = tmp_[i+1];
+            Real drift = 0.0;
             for (Size r=0; r<numberOfFactors_; ++r) {
-                e_[r][i] = e_[r][i+1] + tmp_[i+1] * pseudo_[i+1][r];
-                drifts[i] -= e_[r][i]*pseudo_[i][r];
+                ei[r] = ei1[r] + x * pi1[r];
+                drift -= ei[r]*pi[r];
             }
+            drifts[i] = drift;
 
         }
 
         // 3rd step: now, move forward from N (included) up to n (excluded)
         // (if N=0 this is the only relevant computation):
         for (Size i=numeraire_; i<numberOfRates_; ++i) {
-            drifts[i] = 0.0;
-            for (Size r=0; r<numberOfFactors_; ++r) {
-                if (i==0)
-                    e_[r][i] = tmp_[i] * pseudo_[i][r];
-                else
-                    e_[r][i] = e_[r][i-1] + tmp_[i] * pseudo_[i][r];
-                drifts[i] += e_[r][i]*pseudo_[i][r];
+            Matrix::row_iterator ei = e_.row_begin(i);
+            Matrix::const_row_iterator pi = pseudo_.row_begin(i);
+            const Real x = tmp_[i];
+            Real drift = 0.0;
+            if (i==0) {
+                for (Size r=0; r<numberOfFactors_; ++r) {
+                    ei[r] = x * pi[r];
+                    drift += ei[r]*pi[r];
+                }
+            } else {
+                Matrix::const_row_iterator ei1 = e_.row_begin(i-1);
+                for (Size r=0; r<numberOfFactors_; ++r) {
+                    ei[r] = ei1[r] + x * pi[r];
+                    drift += ei[r]*pi[r];
+                }
             }
+            drifts[i] = drift;
         }
     }
 
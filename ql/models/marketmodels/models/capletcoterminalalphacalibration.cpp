@@ -86,6 +86,46 @@ namespace QuantLib {
 
         std::vector<Matrix>& swapCovariancePseudoRoots) {
 
+        std::vector<Matrix> corrPseudo;
+        CTSMMCapletCalibration::correlationPseudoRoots(corr, numberOfFactors,
+                                                       corrPseudo);
+        Matrix invertedZedMatrix = inverse(
+            SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement));
+
+        return capletAlphaFormCalibration(
+            evolution, corr, displacedSwapVariances, capletVols, cs,
+            alphaInitial, alphaMax, alphaMin, maximizeHomogeneity, parametricForm,
+            numberOfFactors, maxIterations, tolerance,
+            corrPseudo, invertedZedMatrix,
+            alpha, a, b, swapCovariancePseudoRoots);
+    }
+
+    Natural CTSMMCapletAlphaFormCalibration::capletAlphaFormCalibration(
+        const EvolutionDescription& evolution,
+        const PiecewiseConstantCorrelation& corr,
+        const std::vector<ext::shared_ptr<PiecewiseConstantVariance> >& displacedSwapVariances,
+        const std::vector<Volatility>& capletVols,
+        const CurveState& cs,
+
+        const std::vector<Real>& alphaInitial,
+        const std::vector<Real>& alphaMax,
+        const std::vector<Real>& alphaMin,
+        bool maximizeHomogeneity,
+        const ext::shared_ptr<AlphaForm>& parametricForm,
+
+        const Size numberOfFactors,
+        Integer maxIterations,
+        Real tolerance,
+
+        const std::vector<Matrix>& corrPseudo,
+        const Matrix& invertedZedMatrix,
+
+        std::vector<Real>& alpha,
+        std::vector<Real>& a,
+        std::vector<Real>& b,
+
+        std::vector<Matrix>& swapCovariancePseudoRoots) {
+
         CTSMMCapletCalibration::performChecks(evolution, corr,
             displacedSwapVariances, capletVols, cs);
 
@@ -100,6 +140,13 @@ namespace QuantLib {
         QL_REQUIRE(numberOfFactors>0,
                    "number of factors (" << numberOfFactors <<
                    ") must be greater than zero");
+        QL_REQUIRE(corrPseudo.size()==numberOfSteps,
+                   "mismatch between number of steps (" << numberOfSteps <<
+                   ") and correlation pseudo-roots (" << corrPseudo.size() << ")");
+        QL_REQUIRE(invertedZedMatrix.rows()==numberOfRates &&
+                   invertedZedMatrix.columns()==numberOfRates,
+                   "inverted Zed matrix must be " << numberOfRates <<
+                   "x" << numberOfRates);
 
         Natural failures=0;
 
@@ -107,18 +154,6 @@ namespace QuantLib {
         a.resize(numberOfRates);
         b.resize(numberOfRates);
 
-        // factor reduction
-        std::vector<Matrix> corrPseudo(corr.times().size());
-        for (Size i=0; i<corrPseudo.size(); ++i)
-            corrPseudo[i] = rankReducedSqrt(corr.correlation(i),
-                                            numberOfFactors, 1.0,
-                                            SalvagingAlgorithm::None);
-
-        // get Zinverse, we can get wj later
-        Matrix zedMatrix =
-            SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement);
-        Matrix invertedZedMatrix = inverse(zedMatrix);
-
         // vectors for new vol
         std::vector<std::vector<Volatility> > newVols;
         std::vector<Volatility> theseNewVols(numberOfRates);
@@ -241,7 +276,6 @@ namespace QuantLib {
                                           // not mktCapletVols_ but...
                                           usedCapletVols_,
                                           *cs_,
-                                          displacement_,
 
                                           alphaInitial_,
                                           alphaMax_,
@@ -253,6 +287,9 @@ namespace QuantLib {
                                           maxIterations,
                                           tolerance,
 
+                                          corrPseudo_,
+                                          invertedZedMatrix_,
+
                                           alpha_,
                                           a_,
                                           b_,
@@ -66,6 +66,32 @@ namespace QuantLib {
             std::vector<Real>& a,
             std::vector<Real>& b,
 
+            std::vector<Matrix>& swapCovariancePseudoRoots);
+        //! as above, reusing precomputed correlation pseudo-roots and inverted Zed matrix
+        static Natural capletAlphaFormCalibration(
+            const EvolutionDescription& evolution,
+            const PiecewiseConstantCorrelation& corr,
+            const std::vector<ext::shared_ptr<PiecewiseConstantVariance> >& displacedSwapVariances,
+            const std::vector<Volatility>& capletVols,
+            const CurveState& cs,
+
+            const std::vector<Real>& alphaInitial,
+            const std::vector<Real>& alphaMax,
+            const std::vector<Real>& alphaMin,
+            bool maximizeHomogeneity,
+            const ext::shared_ptr<AlphaForm>& parametricForm,
+
+            Size numberOfFactors,
+            Integer steps,
+            Real toleranceForAlphaSolving,
+
+            const std::vector<Matrix>& corrPseudo,
+            const Matrix& invertedZedMatrix,
+
+            std::vector<Real>& alpha,
+            std::vector<Real>& a,
+            std::vector<Real>& b,
+
             std::vector<Matrix>& swapCovariancePseudoRoots);
 
       private:
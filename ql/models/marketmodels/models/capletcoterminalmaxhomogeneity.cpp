@@ -272,10 +272,42 @@ namespace QuantLib {
         const std::vector<Volatility>& capletVols,
         const CurveState& cs,
         const Spread displacement,
+        Real caplet0Swaption1Priority,
+        const Size numberOfFactors,
+        Size maxIterations,
+        Real tolerance,
+        Real& deformationSize,  // ret value
+        Real& totalSwaptionError, // ret value
+        std::vector<Matrix>& swapCovariancePseudoRoots)
+    {
+            std::vector<Matrix> corrPseudo;
+            CTSMMCapletCalibration::correlationPseudoRoots(
+                corr, numberOfFactors, corrPseudo);
+            Matrix invertedZedMatrix = inverse(
+                SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement));
+
+            return capletMaxHomogeneityCalibration(
+                evolution, corr, displacedSwapVariances, capletVols,
+                cs, caplet0Swaption1Priority,
+                numberOfFactors, maxIterations, tolerance,
+                corrPseudo, invertedZedMatrix,
+                deformationSize, totalSwaptionError,
+                swapCovariancePseudoRoots);
+    }
+
+    Natural CTSMMCapletMaxHomogeneityCalibration::capletMaxHomogeneityCalibration(
+        const EvolutionDescription& evolution,
+        const PiecewiseConstantCorrelation& corr,
+        const std::vector<ext::shared_ptr<
+        PiecewiseConstantVariance> >& displacedSwapVariances,
+        const std::vector<Volatility>& capletVols,
+        const CurveState& cs,
         Real caplet0Swaption1Priority, 
         const Size numberOfFactors,
         Size maxIterations,
         Real tolerance,
+        const std::vector<Matrix>& corrPseudo,
+        const Matrix& invertedZedMatrix,
         Real& deformationSize,  // ret value
         Real& totalSwaptionError, // ret value
         std::vector<Matrix>& swapCovariancePseudoRoots) 
@@ -295,6 +327,13 @@ namespace QuantLib {
             QL_REQUIRE(numberOfFactors>0,
                 "number of factors (" << numberOfFactors <<
                 ") must be greater than zero");
+            QL_REQUIRE(corrPseudo.size()==numberOfSteps,
+                       "mismatch between number of steps (" << numberOfSteps <<
+                       ") and correlation pseudo-roots (" << corrPseudo.size() << ")");
+            QL_REQUIRE(invertedZedMatrix.rows()==numberOfRates &&
+                       invertedZedMatrix.columns()==numberOfRates,
+                       "inverted Zed matrix must be " << numberOfRates <<
+                       "x" << numberOfRates);
 
 
             Natural failures=0;
@@ -302,18 +341,6 @@ namespace QuantLib {
             totalSwaptionError = 0.0;
             deformationSize = 0.0;
 
-            // factor reduction
-            std::vector<Matrix> corrPseudo(corr.times().size());
-            for (Size i=0; i<corrPseudo.size(); ++i)
-                corrPseudo[i] = rankReducedSqrt(corr.correlation(i),
-                numberOfFactors, 1.0,
-                SalvagingAlgorithm::None);
-
-            // get Zinverse, we can get wj later
-            Matrix zedMatrix =
-                SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement);
-            Matrix invertedZedMatrix = inverse(zedMatrix);
-
             // vectors for the new vol of all swap rates
             std::vector<std::vector<Volatility> > newVols;
             std::vector<Volatility> theseNewVols(numberOfRates);
@@ -406,7 +433,6 @@ namespace QuantLib {
                 // not mktCapletVols_ but...
                 usedCapletVols_,
                 *cs_, 
-                displacement_, 
 
                 caplet0Swaption1Priority_,
 
@@ -414,6 +440,9 @@ namespace QuantLib {
                 maxIterations,
                 tolerance,
 
+                corrPseudo_,
+                invertedZedMatrix_,
+
                 deformationSize_,
                 totalSwaptionError_,
 
@@ -54,6 +54,22 @@ namespace QuantLib {
             Real& totalSwaptionError,                        // ?
             std::vector<Matrix>& swapCovariancePseudoRoots); // the thing we really want the pseudo
                                                              // root for each time step
+        //! as above, reusing precomputed correlation pseudo-roots and inverted Zed matrix
+        static Natural capletMaxHomogeneityCalibration(
+            const EvolutionDescription& evolution,
+            const PiecewiseConstantCorrelation& corr,
+            const std::vector<ext::shared_ptr<PiecewiseConstantVariance> >& displacedSwapVariances,
+            const std::vector<Volatility>& capletVols,
+            const CurveState& cs,
+            Real caplet0Swaption1Priority,
+            Size numberOfFactors,
+            Size maxIterations,
+            Real tolerance,
+            const std::vector<Matrix>& corrPseudo,
+            const Matrix& invertedZedMatrix,
+            Real& deformationSize,
+            Real& totalSwaptionError,
+            std::vector<Matrix>& swapCovariancePseudoRoots);
 
       private:
         Natural
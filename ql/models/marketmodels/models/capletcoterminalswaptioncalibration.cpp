@@ -62,10 +62,44 @@ namespace QuantLib {
                             bool lowestRoot,
                             bool useFullAprox,
 
+                            Size numberOfFactors,
+
+                            std::vector<Matrix>& swapCovariancePseudoRoots) {
+
+        std::vector<Matrix> corrPseudo;
+        CTSMMCapletCalibration::correlationPseudoRoots(corr, numberOfFactors,
+                                                       corrPseudo);
+        Matrix invertedZedMatrix = inverse(
+            SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement));
+
+        return calibrationFunction(evolution, corr, displacedSwapVariances,
+                                   capletVols, cs,
+                                   alpha, lowestRoot, useFullAprox,
+                                   numberOfFactors,
+                                   corrPseudo, invertedZedMatrix,
+                                   swapCovariancePseudoRoots);
+    }
+
+    Natural CTSMMCapletOriginalCalibration::calibrationFunction(
+                            const EvolutionDescription& evolution,
+                            const PiecewiseConstantCorrelation& corr,
+                            const std::vector<ext::shared_ptr<
+                                PiecewiseConstantVariance> >&
+                                    displacedSwapVariances,
+                            const std::vector<Volatility>& capletVols,
+                            const CurveState& cs,
+
+                            const std::vector<Real>& alpha,
+                            bool lowestRoot,
+                            bool useFullAprox,
+
                             Size numberOfFactors,
                             //Size maxIterations,
                             //Real tolerance,
 
+                            const std::vector<Matrix>& corrPseudo,
+                            const Matrix& invertedZedMatrix,
+
                             std::vector<Matrix>& swapCovariancePseudoRoots) {
 
         CTSMMCapletCalibration::performChecks(evolution, corr,
@@ -82,23 +116,17 @@ namespace QuantLib {
         QL_REQUIRE(numberOfFactors>0,
                    "number of factors (" << numberOfFactors <<
                    ") must be greater than zero");
+        QL_REQUIRE(corrPseudo.size()==numberOfSteps,
+                   "mismatch between number of steps (" << numberOfSteps <<
+                   ") and correlation pseudo-roots (" << corrPseudo.size() << ")");
+        QL_REQUIRE(invertedZedMatrix.rows()==numberOfRates &&
+                   invertedZedMatrix.columns()==numberOfRates,
+                   "inverted Zed matrix must be " << numberOfRates <<
+                   "x" << numberOfRates);
 
         Natural failures = 0;
         Real extraMultiplier = useFullAprox ? 1.0 : 0.0;
 
-        // factor reduction
-        std::vector<Matrix> corrPseudo(corr.times().size());
-        for (Size i=0; i<corrPseudo.size(); ++i)
-            corrPseudo[i] = rankReducedSqrt(corr.correlation(i),
-                                            numberOfFactors, 1.0,
-                                            SalvagingAlgorithm::None);
-
-        Matrix zedMatrix =
-            SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement);
-        Matrix invertedZedMatrix = inverse(zedMatrix);
-
-
-
         // do alpha part
         // first modify variances to take account of alpha
         // then rescale so total variance is unchanged
@@ -340,7 +368,6 @@ namespace QuantLib {
                                    // not mktCapletVols_ but...
                                    usedCapletVols_,
                                    *cs_,
-                                   displacement_,
 
                                    alpha_,
                                    lowestRoot_,
@@ -348,6 +375,9 @@ namespace QuantLib {
 
                                    numberOfFactors,
 
+                                   corrPseudo_,
+                                   invertedZedMatrix_,
+
                                    swapCovariancePseudoRoots_);
     }
 
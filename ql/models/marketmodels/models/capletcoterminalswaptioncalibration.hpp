@@ -58,6 +58,26 @@ namespace QuantLib {
                             //Size maxIterations,
                             //Real tolerance,
 
+                            std::vector<Matrix>& swapCovariancePseudoRoots);
+        //! as above, reusing precomputed correlation pseudo-roots and inverted Zed matrix
+        static Natural calibrationFunction(
+                            const EvolutionDescription& evolution,
+                            const PiecewiseConstantCorrelation& corr,
+                            const std::vector<ext::shared_ptr<
+                                PiecewiseConstantVariance> >&
+                                    displacedSwapVariances,
+                            const std::vector<Volatility>& capletVols,
+                            const CurveState& cs,
+
+                            const std::vector<Real>& alpha,
+                            bool lowestRoot,
+                            bool useFullApprox,
+
+                            Size numberOfFactors,
+
+                            const std::vector<Matrix>& corrPseudo,
+                            const Matrix& invertedZedMatrix,
+
                             std::vector<Matrix>& swapCovariancePseudoRoots);
       private:
         Natural calibrationImpl_(Natural numberOfFactors, Natural, Real) override;
@@ -27,6 +27,7 @@
 #include <ql/models/marketmodels/models/pseudorootfacade.hpp>
 #include <ql/models/marketmodels/swapforwardmappings.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <string>
 #include <utility>
 
 namespace QuantLib {
@@ -118,6 +119,40 @@ namespace QuantLib {
                    lastSwaptionVol-mktCapletVols[numberOfRates-1]);
     }
 
+    void CTSMMCapletCalibration::correlationPseudoRoots(
+                                    const PiecewiseConstantCorrelation& corr,
+                                    Size numberOfFactors,
+                                    std::vector<Matrix>& pseudoRoots) {
+        Size numberOfRates = corr.numberOfRates();
+        QL_REQUIRE(numberOfFactors<=numberOfRates,
+                   "number of factors (" << numberOfFactors <<
+                   ") cannot be greater than numberOfRates (" <<
+                   numberOfRates << ")");
+        QL_REQUIRE(numberOfFactors>0,
+                   "number of factors (" << numberOfFactors <<
+                   ") must be greater than zero");
+
+        const std::vector<Matrix>& correlations = corr.correlations();
+        pseudoRoots.resize(correlations.size());
+        std::string error;
+
+        #pragma omp parallel for
+        for (long i=0; i<long(correlations.size()); ++i) {
+            try {
+                pseudoRoots[i] = rankReducedSqrt(correlations[i],
+                                                 numberOfFactors, 1.0,
+                                                 SalvagingAlgorithm::None);
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+        }
+        QL_REQUIRE(error.empty(), error);
+    }
+
     bool CTSMMCapletCalibration::calibrate(Natural numberOfFactors,
 
                                            Natural maxIterations,
@@ -134,6 +169,9 @@ namespace QuantLib {
 
         // initialize working variables
         usedCapletVols_ = mktCapletVols_;
+        correlationPseudoRoots(*corr_, numberOfFactors, corrPseudo_);
+        invertedZedMatrix_ = inverse(
+            SwapForwardMappings::coterminalSwapZedMatrix(*cs_, displacement_));
 
         for (Size i=0; i<numberOfRates_; ++i)
             mktSwaptionVols_[i]=displacedSwapVariances_[i]->totalVolatility(i);
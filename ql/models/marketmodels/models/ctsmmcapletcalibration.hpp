@@ -21,6 +21,7 @@
 #ifndef quantlib_ctsmm_caplet_calibration_hpp
 #define quantlib_ctsmm_caplet_calibration_hpp
 
+#include <ql/math/matrix.hpp>
 #include <ql/models/marketmodels/curvestate.hpp>
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/models/marketmodels/piecewiseconstantcorrelation.hpp>
@@ -30,7 +31,6 @@
 namespace QuantLib {
 
     class PiecewiseConstantVariance;
-    class Matrix;
 
     class CTSMMCapletCalibration {
       public:
@@ -79,6 +79,15 @@ namespace QuantLib {
             const std::vector<Volatility>& mktCapletVols,
             const CurveState& cs);
 
+        //! rank-reduced pseudo-roots of the correlation at each step
+        /*! The decompositions are independent of each other and are
+            performed in parallel when OpenMP is enabled.
+        */
+        static void correlationPseudoRoots(
+            const PiecewiseConstantCorrelation& corr,
+            Size numberOfFactors,
+            std::vector<Matrix>& pseudoRoots);
+
         const ext::shared_ptr<CurveState>& curveState() const;
         std::vector<Spread> displacements() const;
       protected:
@@ -101,6 +110,9 @@ namespace QuantLib {
         Size numberOfRates_;
         // working variables
         std::vector<Volatility> usedCapletVols_;
+        // don't depend on usedCapletVols_; computed once per calibration
+        std::vector<Matrix> corrPseudo_;
+        Matrix invertedZedMatrix_;
         // results
         bool calibrated_;
         Natural failures_;
@@ -87,6 +87,8 @@ namespace QuantLib {
         const vector<Time>& corrTimes = corr->times();
         const vector<Time>& evolTimes = evolution.evolutionTimes();
         Matrix covariance(numberOfRates_, numberOfRates_);
+        // steps with proportional covariances share their decomposition
+        PseudoSqrtCache pseudoSqrtCache;
         for (Size k=0, kk=0; k<numberOfSteps_; ++k) {
             // one covariance per evolution step
             std::fill(covariance.begin(), covariance.end(), 0.0);
@@ -129,9 +131,9 @@ namespace QuantLib {
                  }
             }
 
-            pseudoRoots_[k] = rankReducedSqrt(covariance,
-                                              numberOfFactors, 1.0,
-                                              SalvagingAlgorithm::None);
+            pseudoRoots_[k] = pseudoSqrtCache.rankReducedSqrt(covariance,
+                                                numberOfFactors, 1.0,
+                                                SalvagingAlgorithm::None);
 
             QL_ENSURE(pseudoRoots_[k].rows()==numberOfRates_,
                       "step " << k
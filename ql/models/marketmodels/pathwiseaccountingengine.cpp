@@ -120,7 +120,7 @@ namespace QuantLib {
     Real PathwiseAccountingEngine::singlePathValues(std::vector<Real>& values)
     {
 
-        const std::vector<Real> initialForwards_(pseudoRootStructure_->initialRates());
+        const std::vector<Real>& initialForwards_(pseudoRootStructure_->initialRates());
         currentForwards_ = initialForwards_;
         // clear accumulation variables
         for (Size i=0; i < numberProducts_; ++i)
@@ -742,6 +742,17 @@ namespace QuantLib {
 
         numberBumps_ = vegaBumps[0].size();
 
+        // store the non-null bump elements, indexed as the elementary vegas
+        sparseVegaBumps_.resize(numberBumps_);
+        for (Size bump=0; bump < numberBumps_; ++bump)
+            for (Size t=0; t < numberSteps_; ++t)
+                for (Size r=0; r < numberRates_; ++r)
+                    for (Size f=0; f < factors_; ++f)
+                        if (vegaBumps[t][bump][r][f] != 0.0)
+                            sparseVegaBumps_[bump].emplace_back(
+                                t*numberRates_*factors_+r*factors_+f,
+                                vegaBumps[t][bump][r][f]);
+
        std::vector<Matrix> jacobiansThisPathsModel;
        for (Size i =0; i < numberRates_; ++i)
            jacobiansThisPathsModel.emplace_back(numberRates_, factors_);
@@ -1054,36 +1065,42 @@ namespace QuantLib {
         } // end of  for (Integer currentStep =  numberSteps_-1; currentStep >=0 ; --currentStep)
 
 
-        // all V matrices computed we now compute the elementary vegas for this path 
+        // all V matrices computed we now compute the elementary vegas for this path
 
-        for (Size i=0; i < numberProducts_; ++i)
+        // We know V, we need to pair against the senstivity of the rate to the
+        // elementary vega. Note the simplification here arising from the fact
+        // that the elementary vega affects the evolution on precisely one step.
+        // Moreover, rate r is not sensitive to the rows k > r of the pseudo-root
+        // (their entries in the jacobians are set to zero) so those terms are
+        // skipped, as are the rates with no sensitivity, and each jacobian is
+        // accumulated row by row over contiguous memory.  Steps are independent
+        // of each other and are processed in parallel when OpenMP is enabled.
+        #pragma omp parallel for
+        for (long j=0; j < long(numberSteps_); ++j)
         {
-                for (Size j=0; j < numberSteps_; ++j)
-                {
-                    Size nextIndex = j+1;
-
-                    // we know V, we need to pair against the senstivity of the rate to the elementary vega
-                    // note the simplification here arising from the fact that the elementary vega affects the evolution on precisely one step
-
-                    for (Size k=0; k < numberRates_; ++k)
-                        for (Size f=0; f < factors_; ++f)
-                        {
-                                Real sensitivity =0.0;
-
-                                for (Size r=0; r < numberRates_; ++r)
-                                {
-                                        sensitivity += V_[i][nextIndex][r]*jacobiansThisPaths_[j][r][k][f];
+            Size nextIndex = j+1;
 
-                                  }
-/*
-                                  if (j ==distinguishedStep_ && k ==distinguishedRate_ &&f== distinguishedFactor_)
-                                      std::cout << sensitivity << "," <<  jacobiansThisPaths_[j][j][k][f] << "," << gaussians_[j][f] << "," << V_[i][nextIndex][j] << "," << LIBORRates_[nextIndex][j] << "\n";
-  */                
+            for (Size i=0; i < numberProducts_; ++i)
+            {
+                Matrix& vegas = elementary_vegas_ThisPath_[i][j];
+                std::fill(vegas.begin(), vegas.end(), 0.0);
 
+                for (Size r=0; r < numberRates_; ++r)
+                {
+                    Real v = V_[i][nextIndex][r];
+                    if (v == 0.0)
+                        continue;
 
-                                elementary_vegas_ThisPath_[i][j][k][f] = sensitivity;
-                        }
+                    const Matrix& jacobian = jacobiansThisPaths_[j][r];
+                    for (Size k=0; k <= r; ++k)
+                    {
+                        Matrix::const_row_iterator jac = jacobian.row_begin(k);
+                        Matrix::row_iterator vega = vegas.row_begin(k);
+                        for (Size f=0; f < factors_; ++f)
+                            vega[f] += v*jac[f];
+                    }
                 }
+            }
         }
 
 
@@ -1168,12 +1185,11 @@ namespace QuantLib {
                 {
                     Real thisVega=0.0;
 
-
-                    for (Size t=0; t < numberSteps_; ++t)
-                        for (Size r=0; r < numberRates_; ++r)
-                            for (Size f=0; f < factors_; ++f)
-                                thisVega+= vegaBumps_[t][bump][r][f]*allMeans[p*inDataPerProduct+1+numberRates_+t*numberRates_*factors_+r*factors_+f];
-
+                    // only the non-null elements of the bump contribute
+                    const std::vector<std::pair<Size, Real> >& elements =
+                        sparseVegaBumps_[bump];
+                    for (const auto& element : elements)
+                        thisVega += element.second*allMeans[p*inDataPerProduct+1+numberRates_+element.first];
 
                     means[p*outDataPerProduct+1+numberRates_+bump] = thisVega;
                }
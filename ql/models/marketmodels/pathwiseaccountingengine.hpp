@@ -221,6 +221,8 @@ namespace QuantLib {
         Clone<MarketModelPathwiseMultiProduct> product_;
         ext::shared_ptr<MarketModel> pseudoRootStructure_;
         std::vector<std::vector<Matrix> > vegaBumps_; 
+        // non-null elements of each bump, as (elementary vega index, value)
+        std::vector<std::vector<std::pair<Size, Real> > > sparseVegaBumps_;
         std::vector<Size> numeraires_;
 
         Real initialNumeraireValue_;
@@ -23,6 +23,7 @@
 #include <ql/math/optimization/projection.hpp>
 #include <ql/models/model.hpp>
 #include <ql/utilities/null_deleter.hpp>
+#include <algorithm>
 #include <utility>
 
 using std::vector;
@@ -153,4 +154,35 @@ namespace QuantLib {
     ShortRateModel::ShortRateModel(Size nArguments)
     : CalibratedModel(nArguments) {}
 
+    ext::shared_ptr<Lattice>
+    ShortRateModel::cachedTree(const TimeGrid& grid) const {
+        Array parameters = params();
+        if (parameters.size() != cachedTreeParams_.size() ||
+            !std::equal(parameters.begin(), parameters.end(),
+                        cachedTreeParams_.begin())) {
+            cachedTrees_.clear();
+            cachedTreeParams_ = parameters;
+        }
+
+        for (auto i = cachedTrees_.begin(); i != cachedTrees_.end(); ++i) {
+            const TimeGrid& cachedGrid = i->first;
+            if (cachedGrid.size() == grid.size() &&
+                std::equal(grid.begin(), grid.end(), cachedGrid.begin())) {
+                cachedTrees_.splice(cachedTrees_.begin(), cachedTrees_, i);
+                return i->second;
+            }
+        }
+
+        ext::shared_ptr<Lattice> lattice = tree(grid);
+        cachedTrees_.emplace_front(grid, lattice);
+        if (cachedTrees_.size() > SHORTRATEMODEL_TREE_CACHE_SIZE)
+            cachedTrees_.pop_back();
+        return lattice;
+    }
+
+    void ShortRateModel::update() {
+        cachedTrees_.clear();
+        CalibratedModel::update();
+    }
+
 }
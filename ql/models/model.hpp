@@ -31,8 +31,15 @@
 #include <ql/models/calibrationhelper.hpp>
 #include <ql/models/parameter.hpp>
 #include <ql/option.hpp>
+#include <list>
 #include <utility>
 
+/*! Maximum number of trees (i.e., of distinct time grids) kept by a
+    short-rate model, the least recently used one is dropped first. */
+#ifndef SHORTRATEMODEL_TREE_CACHE_SIZE
+#define SHORTRATEMODEL_TREE_CACHE_SIZE 16
+#endif
+
 namespace QuantLib {
 
     class OptimizationMethod;
@@ -138,11 +145,30 @@ namespace QuantLib {
     };
 
     //! Abstract short-rate model class
-    /*! \ingroup shortrate */
+    /*! Trees returned by cachedTree() are kept by the model and
+        returned again for equal time grids, until the model
+        parameters change or the model is notified of a change in its
+        inputs.  Tree engines use it, so that engines sharing a model
+        and a time grid (e.g., a grid including the mandatory times
+        of a whole portfolio) share a single fitted tree.
+
+        \warning the cached trees are shared; callers modifying a
+                 tree (e.g., by setting a spread on it) must restore
+                 its state afterwards.
+
+        \ingroup shortrate */
     class ShortRateModel : public CalibratedModel {
       public:
         explicit ShortRateModel(Size nArguments);
         virtual ext::shared_ptr<Lattice> tree(const TimeGrid&) const = 0;
+        //! returns tree(grid), reusing a tree built for an equal grid
+        ext::shared_ptr<Lattice> cachedTree(const TimeGrid& grid) const;
+        void update() override;
+
+      private:
+        typedef std::pair<TimeGrid, ext::shared_ptr<Lattice> > CachedTree;
+        mutable std::list<CachedTree> cachedTrees_;
+        mutable Array cachedTreeParams_;
     };
 
 
@@ -83,6 +83,27 @@ namespace QuantLib {
     : TreeLattice1D<OneFactorModel::ShortRateTree>(timeGrid, tree->size(1)), tree_(tree),
       dynamics_(std::move(dynamics)), spread_(0.0) {}
 
+    void OneFactorModel::ShortRateTree::stepback(Size i,
+                                                 const Array& values,
+                                                 Array& newValues) const {
+        const Array& discount = discounts(i);
+        tree_->expectedValues(i, values, newValues);
+        for (Size j=0; j<newValues.size(); j++)
+            newValues[j] *= discount[j];
+    }
+
+    const Array& OneFactorModel::ShortRateTree::discounts(Size i) const {
+        if (discounts_.size() <= i)
+            discounts_.resize(timeGrid().size() - 1);
+        Array& discount = discounts_[i];
+        if (discount.empty()) {
+            discount = Array(size(i));
+            for (Size j=0; j<discount.size(); j++)
+                discount[j] = this->discount(i, j);
+        }
+        return discount;
+    }
+
     OneFactorModel::OneFactorModel(Size nArguments)
     : ShortRateModel(nArguments) {}
 
@@ -72,6 +72,12 @@ namespace QuantLib {
     };
 
     //! Recombining trinomial tree discretizing the state variable
+    /*! The rollback uses a compiled representation of the tree: the
+        discount factors of each step are computed once, on the first
+        rollback through the step, and stored together with the
+        contiguous branching data of the trinomial tree. They are
+        recomputed after a change of the spread.
+    */
     class OneFactorModel::ShortRateTree
         : public TreeLattice1D<OneFactorModel::ShortRateTree> {
       public:
@@ -105,12 +111,18 @@ namespace QuantLib {
         void setSpread(Spread spread)
         {
             spread_=spread;
+            discounts_.clear();
         }
+        void stepback(Size i,
+                      const Array& values,
+                      Array& newValues) const;
       private:
+        const Array& discounts(Size i) const;
         ext::shared_ptr<TrinomialTree> tree_;
         ext::shared_ptr<ShortRateDynamics> dynamics_;
         class Helper;
         Spread spread_;
+        mutable std::vector<Array> discounts_;
     };
 
     //! Single-factor affine base class
@@ -68,9 +68,18 @@ namespace QuantLib {
 
     ext::shared_ptr<Lattice>
     BlackKarasinski::tree(const TimeGrid& grid) const {
+        // each tree is fitted with its own parameter, so that trees
+        // built before (and possibly shared, see cachedTree) stay valid
+        TermStructureFittingParameter phi(termStructure());
+        return fittedTree(grid, phi);
+    }
+
+    ext::shared_ptr<OneFactorModel::ShortRateTree>
+    BlackKarasinski::fittedTree(const TimeGrid& grid,
+                                const Parameter& phi) const {
 
         ext::shared_ptr<ShortRateDynamics> numericDynamics(
-                         new Dynamics(phi_, a(), sigma()));
+                         new Dynamics(phi, a(), sigma()));
         ext::shared_ptr<TrinomialTree> trinomial(
                          new TrinomialTree(numericDynamics->process(), grid));
         ext::shared_ptr<ShortRateTree> numericTree(
@@ -78,7 +87,7 @@ namespace QuantLib {
 
         typedef TermStructureFittingParameter::NumericalImpl NumericalImpl;
         ext::shared_ptr<NumericalImpl> impl =
-            ext::dynamic_pointer_cast<NumericalImpl>(phi_.implementation());
+            ext::dynamic_pointer_cast<NumericalImpl>(phi.implementation());
         impl->reset();
         Real value = 1.0;
         Real vMin = -50.0;
@@ -100,8 +109,7 @@ namespace QuantLib {
         BlackKarasinski::dynamics() const {
         // Calibrate fitting parameter to term structure
         Size steps = 50;
-        ext::shared_ptr<Lattice> lattice = this->tree(
-            TimeGrid(termStructure()->maxTime(), steps));
+        fittedTree(TimeGrid(termStructure()->maxTime(), steps), phi_);
         ext::shared_ptr<ShortRateDynamics> numericDynamics(
             new Dynamics(phi_, a(), sigma()));
         return numericDynamics;
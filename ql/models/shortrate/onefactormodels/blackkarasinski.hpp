@@ -53,6 +53,9 @@ namespace QuantLib {
         class Dynamics;
         class Helper;
 
+        ext::shared_ptr<ShortRateTree> fittedTree(const TimeGrid& grid,
+                                                  const Parameter& phi) const;
+
         Real a() const { return a_(0.0); }
         Real sigma() const { return sigma_(0.0); }
 
@@ -20,6 +20,7 @@
 #include <ql/models/shortrate/onefactormodels/gaussian1dmodel.hpp>
 #include <ql/math/interpolations/cubicinterpolation.hpp>
 #include <ql/payoff.hpp>
+#include <algorithm>
 
 using std::exp;
 
@@ -141,6 +142,93 @@ Real Gaussian1dModel::swapAnnuity(const Date& fixing,
     return annuity;
 }
 
+Disposable<Array> Gaussian1dModel::forwardRate(const Date& fixing,
+                                               const Date& referenceDate,
+                                               const Array& y,
+                                               const ext::shared_ptr<IborIndex>& iborIdx) const {
+
+    QL_REQUIRE(iborIdx != nullptr, "no ibor index given");
+
+    calculate();
+
+    if (fixing <= (evaluationDate_ + (enforcesTodaysHistoricFixings_ ? 0 : -1))) {
+        Array result(y.size(), iborIdx->fixing(fixing));
+        return result;
+    }
+
+    Handle<YieldTermStructure> yts = iborIdx->forwardingTermStructure(); // might be empty, then
+                                                                         // use model curve
+
+    Date valueDate = iborIdx->valueDate(fixing);
+    Date endDate = iborIdx->fixingCalendar().advance(
+        valueDate, iborIdx->tenor(), iborIdx->businessDayConvention(), iborIdx->endOfMonth());
+    // FIXME Here we should use the calculation date calendar ?
+    Real dcf = iborIdx->dayCounter().yearFraction(valueDate, endDate);
+
+    Array zbValue = zerobond(valueDate, referenceDate, y, yts);
+    Array zbEnd = zerobond(endDate, referenceDate, y, yts);
+
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = (zbValue[i] - zbEnd[i]) / (dcf * zbEnd[i]);
+    return result;
+}
+
+Disposable<Array>
+Gaussian1dModel::numeraireImpl(const Time t, const Array& y,
+                               const Handle<YieldTermStructure>& yts) const {
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = numeraireImpl(t, y[i], yts);
+    return result;
+}
+
+Disposable<Array>
+Gaussian1dModel::zerobondImpl(const Time T, const Time t, const Array& y,
+                              const Handle<YieldTermStructure>& yts) const {
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = zerobondImpl(T, t, y[i], yts);
+    return result;
+}
+
+Disposable<Array>
+Gaussian1dModel::cachedGridValues(const Time T, const Time t, const Array& y,
+                                  const Handle<YieldTermStructure>& yts) const {
+
+    // a recalculation flushes the memo
+    calculate();
+
+    // only values on the model curve are memoized, since the model is
+    // not notified of changes in other curves
+    if (!yts.empty() && yts.currentLink() != termStructure().currentLink())
+        return T == Null<Real>() ? numeraireImpl(t, y, yts)
+                                 : zerobondImpl(T, t, y, yts);
+
+    CachedGridKey k = {T, t, yts.empty() ? nullptr : yts.currentLink().get(),
+                       y.size(), y.empty() ? 0.0 : y.front(),
+                       y.empty() ? 0.0 : y.back()};
+    GridCacheType::iterator i = gridCache_.find(k);
+    if (i != gridCache_.end() &&
+        std::equal(y.begin(), y.end(), i->second.y.begin())) {
+        Array result = i->second.values;
+        return result;
+    }
+
+    Array result = T == Null<Real>() ? numeraireImpl(t, y, yts)
+                                     : zerobondImpl(T, t, y, yts);
+    if (i != gridCache_.end()) {
+        i->second.y = y;
+        i->second.values = result;
+    } else {
+        if (gridCache_.size() >= GAUSSIAN1DMODEL_GRID_CACHE_SIZE)
+            gridCache_.clear();
+        CachedGridValues v = {y, result};
+        gridCache_.insert(std::make_pair(k, v));
+    }
+    return result;
+}
+
 Real Gaussian1dModel::zerobondOption(
     const Option::Type &type, const Date &expiry, const Date &valueDate,
     const Date &maturity, const Rate strike, const Date &referenceDate,
@@ -161,14 +249,15 @@ Real Gaussian1dModel::zerobondOption(
 
     Array p(yg.size());
 
+    Array expValDsc = zerobond(valueDate, expiry, yg, yts);
+    Array maturityDsc = zerobond(maturity, expiry, yg, yts);
+    Array numeraires = numeraire(fixingTime, yg, yts);
     for (Size i = 0; i < yg.size(); i++) {
-        Real expValDsc = zerobond(valueDate, expiry, yg[i], yts);
-        Real discount =
-            zerobond(maturity, expiry, yg[i], yts) / expValDsc;
+        Real discount = maturityDsc[i] / expValDsc[i];
         p[i] =
             std::max((type == Option::Call ? 1.0 : -1.0) * (discount - strike),
                      0.0) /
-            numeraire(fixingTime, yg[i], yts) * expValDsc;
+            numeraires[i] * expValDsc[i];
     }
 
     CubicInterpolation payoff(
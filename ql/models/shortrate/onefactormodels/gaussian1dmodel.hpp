@@ -43,6 +43,12 @@
 #include <boost/math/bindings/rr.hpp>
 #endif
 
+/* maximum number of memoized numeraire and zerobond grids, the memo
+   is flushed completely when this number is reached */
+#ifndef GAUSSIAN1DMODEL_GRID_CACHE_SIZE
+#define GAUSSIAN1DMODEL_GRID_CACHE_SIZE 4096
+#endif
+
 #if defined(__GNUC__) &&                                                       \
     (((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)) || (__GNUC__ > 4))
 #pragma GCC diagnostic push
@@ -68,9 +74,22 @@ namespace QuantLib {
     file. For details on NTL see
              http://www.shoup.net/ntl/
 
+    The numeraire, zerobond and forwardRate methods are also
+    available for arrays of state variable values. The numeraire and
+    zerobond arrays computed on the model curve are memoized per
+    time and grid until the model is recalculated or recalibrated,
+    so that engines rolling back on a fixed grid only evaluate the
+    model once per cashflow and exercise date. Derived classes may
+    override the array versions of numeraireImpl and zerobondImpl
+    to hoist the state independent terms out of the loop over the
+    grid, by default the scalar implementations are called.
+
     \warning the variance of the state process conditional on
     $x(t)=x$ must be independent of the value of $x$
 
+    \warning the memo is not thread safe, the array methods must
+    not be called from within parallel regions
+
 */
 
 class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
@@ -95,6 +114,28 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
                   Real y = 0.0,
                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
 
+    Disposable<Array>
+    numeraire(Time t,
+              const Array& y,
+              const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Disposable<Array>
+    zerobond(Time T,
+             Time t,
+             const Array& y,
+             const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Disposable<Array>
+    numeraire(const Date& referenceDate,
+              const Array& y,
+              const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Disposable<Array>
+    zerobond(const Date& maturity,
+             const Date& referenceDate,
+             const Array& y,
+             const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
     Real zerobondOption(const Option::Type& type,
                         const Date& expiry,
                         const Date& valueDate,
@@ -114,6 +155,12 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
                 Real y = 0.0,
                 const ext::shared_ptr<IborIndex>& iborIdx = ext::shared_ptr<IborIndex>()) const;
 
+    Disposable<Array>
+    forwardRate(const Date& fixing,
+                const Date& referenceDate,
+                const Array& y,
+                const ext::shared_ptr<IborIndex>& iborIdx) const;
+
     Real swapRate(const Date& fixing,
                   const Period& tenor,
                   const Date& referenceDate = Null<Date>(),
@@ -184,6 +231,46 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
 
     mutable CacheType swapCache_;
 
+    // numeraire (T = Null<Real>()) and zerobond values on grids of the
+    // state variable, the key identifies the grid by its size and end
+    // points, the full grid is compared on lookup
+
+    struct CachedGridKey {
+        Time T, t;
+        const YieldTermStructure* yts;
+        Size size;
+        Real front, back;
+        bool operator==(const CachedGridKey &o) const {
+            return T == o.T && t == o.t && yts == o.yts && size == o.size &&
+                   front == o.front && back == o.back;
+        }
+    };
+
+    struct CachedGridKeyHasher {
+        std::size_t operator()(CachedGridKey const &x) const {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, x.T);
+            boost::hash_combine(seed, x.t);
+            boost::hash_combine(seed, x.yts);
+            boost::hash_combine(seed, x.size);
+            boost::hash_combine(seed, x.front);
+            boost::hash_combine(seed, x.back);
+            return seed;
+        }
+    };
+
+    struct CachedGridValues {
+        Array y, values;
+    };
+
+    typedef boost::unordered_map<CachedGridKey, CachedGridValues,
+                                 CachedGridKeyHasher> GridCacheType;
+
+    mutable GridCacheType gridCache_;
+
+    Disposable<Array> cachedGridValues(Time T, Time t, const Array& y,
+                                       const Handle<YieldTermStructure>& yts) const;
+
   protected:
     // we let derived classes register with the termstructure
     Gaussian1dModel(const Handle<YieldTermStructure> &yieldTermStructure)
@@ -198,17 +285,29 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
     virtual Real
     zerobondImpl(Time T, Time t, Real y, const Handle<YieldTermStructure>& yts) const = 0;
 
+    virtual Disposable<Array>
+    numeraireImpl(Time t, const Array& y, const Handle<YieldTermStructure>& yts) const;
+
+    virtual Disposable<Array>
+    zerobondImpl(Time T, Time t, const Array& y, const Handle<YieldTermStructure>& yts) const;
+
     void performCalculations() const override {
         evaluationDate_ = Settings::instance().evaluationDate();
         enforcesTodaysHistoricFixings_ =
             Settings::instance().enforcesTodaysHistoricFixings();
+        flushGridCache();
     }
 
     void generateArguments() {
         calculate();
+        flushGridCache();
         notifyObservers();
     }
 
+    // to be called by derived classes whenever the model changes
+    // without a recalculation, e.g. when new parameters are set
+    void flushGridCache() const { gridCache_.clear(); }
+
     // retrieve underlying swap from cache if possible, otherwise
     // create it and store it in the cache
     ext::shared_ptr<VanillaSwap>
@@ -250,6 +349,36 @@ Gaussian1dModel::zerobond(const Time T, const Time t, const Real y,
     return zerobondImpl(T, t, y, yts);
 }
 
+inline Disposable<Array>
+Gaussian1dModel::numeraire(const Time t, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+    return cachedGridValues(Null<Real>(), t, y, yts);
+}
+
+inline Disposable<Array>
+Gaussian1dModel::zerobond(const Time T, const Time t, const Array &y,
+                          const Handle<YieldTermStructure> &yts) const {
+    return cachedGridValues(T, t, y, yts);
+}
+
+inline Disposable<Array>
+Gaussian1dModel::numeraire(const Date &referenceDate, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+
+    return numeraire(termStructure()->timeFromReference(referenceDate), y, yts);
+}
+
+inline Disposable<Array>
+Gaussian1dModel::zerobond(const Date &maturity, const Date &referenceDate,
+                          const Array &y, const Handle<YieldTermStructure> &yts) const {
+
+    return zerobond(termStructure()->timeFromReference(maturity),
+                    referenceDate != Null<Date>()
+                        ? termStructure()->timeFromReference(referenceDate)
+                        : 0.0,
+                    y, yts);
+}
+
 inline Real
 Gaussian1dModel::numeraire(const Date &referenceDate, const Real y,
                            const Handle<YieldTermStructure> &yts) const {
@@ -216,4 +216,57 @@ Real Gsr::numeraireImpl(const Time t, const Real y,
                    : yts->discount(p->getForwardMeasureTime());
     return zerobond(p->getForwardMeasureTime(), t, y, yts);
 }
+
+Disposable<Array> Gsr::zerobondImpl(const Time T, const Time t, const Array& y,
+                                    const Handle<YieldTermStructure> &yts) const {
+
+    calculate();
+
+    if (t == 0.0) {
+        Array result(y.size(), yts.empty() ? this->termStructure()->discount(T, true)
+                                           : yts->discount(T, true));
+        return result;
+    }
+
+    ext::shared_ptr<GsrProcess> p =
+        ext::dynamic_pointer_cast<GsrProcess>(stateProcess_);
+
+    // everything but the state variable itself is independent of y,
+    // in particular G does not depend on x
+    Real stdDev = stateProcess_->stdDeviation(0.0, 0.0, t);
+    Real expectation = stateProcess_->expectation(0.0, 0.0, t);
+    Real gtT = p->G(t, T, 0.0);
+    Real yt = p->y(t);
+
+    Real d = yts.empty()
+                 ? termStructure()->discount(T, true) /
+                       termStructure()->discount(t, true)
+                 : yts->discount(T, true) / yts->discount(t, true);
+
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i) {
+        Real x = y[i] * stdDev + expectation;
+        result[i] = d * exp(-x * gtT - 0.5 * yt * gtT * gtT);
+    }
+    return result;
+}
+
+Disposable<Array> Gsr::numeraireImpl(const Time t, const Array& y,
+                                     const Handle<YieldTermStructure> &yts) const {
+
+    calculate();
+
+    ext::shared_ptr<GsrProcess> p =
+        ext::dynamic_pointer_cast<GsrProcess>(stateProcess_);
+
+    if (t == 0) {
+        Array result(y.size(),
+                     yts.empty()
+                         ? this->termStructure()->discount(p->getForwardMeasureTime(),
+                                                           true)
+                         : yts->discount(p->getForwardMeasureTime()));
+        return result;
+    }
+    return zerobondImpl(p->getForwardMeasureTime(), t, y, yts);
+}
 }
@@ -141,8 +141,17 @@ class Gsr : public Gaussian1dModel, public CalibratedModel {
 
     Real zerobondImpl(Time T, Time t, Real y, const Handle<YieldTermStructure>& yts) const override;
 
+    Disposable<Array>
+    numeraireImpl(Time t, const Array& y, const Handle<YieldTermStructure>& yts) const override;
+
+    Disposable<Array> zerobondImpl(Time T,
+                                   Time t,
+                                   const Array& y,
+                                   const Handle<YieldTermStructure>& yts) const override;
+
     void generateArguments() override {
         ext::static_pointer_cast<GsrProcess>(stateProcess_)->flushCache();
+        flushGridCache();
         notifyObservers();
     }
 
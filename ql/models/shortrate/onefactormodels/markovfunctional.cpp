@@ -27,6 +27,8 @@
 #include <ql/termstructures/volatility/sabrinterpolatedsmilesection.hpp>
 #include <ql/termstructures/volatility/smilesection.hpp>
 #include <ql/termstructures/volatility/smilesectionutils.hpp>
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 namespace QuantLib {
@@ -336,6 +338,33 @@ namespace QuantLib {
             i->second.rawSmileSection_ = ext::shared_ptr<SmileSection>(
                 new AtmSmileSection(smileSection, i->second.atm_));
 
+            std::vector<Real> fingerprint;
+            if (modelSettings_.incrementalCalibration_) {
+                fingerprint = smileFingerprint(i->first, i->second);
+                if (i->second.smileSection_ != nullptr &&
+                    fingerprint == i->second.smileFingerprint_) {
+                    // the market inputs did not change, so we keep the
+                    // pretreated smile section and the digital bounds
+                    if ((modelSettings_.adjustments_ &
+                         (ModelSettings::KahaleSmile |
+                          ModelSettings::SabrSmile)) != 0) {
+                        arbitrageIndices_.push_back(
+                            ext::dynamic_pointer_cast<KahaleSmileSection>(
+                                i->second.smileSection_)->coreIndices());
+                    } else if ((modelSettings_.adjustments_ &
+                                ModelSettings::CustomSmile) != 0) {
+                        arbitrageIndices_.emplace_back(Null<Size>(),
+                                                       Null<Size>());
+                    }
+                    ++pointIndex;
+                    continue;
+                }
+                // only set again once the smile section is rebuilt
+                i->second.smileFingerprint_.clear();
+            }
+            // the flag is reset once the numeraire is tabulated
+            i->second.smileChanged_ = true;
+
             int forcedLeftIndex = -1;
             int forcedRightIndex = QL_MAX_INTEGER;
             if(forcedArbitrageIndices_.size() > pointIndex) {
@@ -446,21 +475,81 @@ namespace QuantLib {
                         modelSettings_.digitalGap_);
             }
 
+            if (modelSettings_.incrementalCalibration_)
+                i->second.smileFingerprint_.swap(fingerprint);
+
             ++pointIndex;
         }
     }
 
+    Disposable<std::vector<Real> >
+    MarkovFunctional::smileFingerprint(const Date& expiry,
+                                       const CalibrationPoint& p) const {
+
+        std::vector<Real> result;
+        result.push_back(p.atm_);
+        result.push_back(p.annuity_);
+        result.push_back(termStructure()->discount(expiry, true));
+        for (auto paymentDate : p.paymentDates_)
+            result.push_back(termStructure()->discount(paymentDate, true));
+
+        SmileSectionUtils ssutils(*p.rawSmileSection_,
+                                  modelSettings_.smileMoneynessCheckpoints_,
+                                  p.atm_);
+        result.insert(result.end(), ssutils.strikeGrid().begin(),
+                      ssutils.strikeGrid().end());
+        result.insert(result.end(), ssutils.callPrices().begin(),
+                      ssutils.callPrices().end());
+
+        return result;
+    }
+
     void MarkovFunctional::updateNumeraireTabulation() const {
 
         QL_MFMESSAGE(modelOutputs_, "updating numeraire tabulation");
         modelOutputs_.dirty_ = true;
 
-        modelOutputs_.adjustmentFactors_.clear();
-        modelOutputs_.digitalsAdjustmentFactors_.clear();
+        // this also triggers the computation of a lazy yield term
+        // structure, so that no recalculation occurs in the parallelized
+        // loops below
+        Real numeraire0 = termStructure()->discount(numeraireTime_, true);
+
+        // in incremental mode the trailing run of calibration points with
+        // unchanged market inputs keeps its tabulation, since the numeraire
+        // on a calibration time only depends on later calibration points,
+        // provided that the volatilities and the time grid are unchanged
+        Size unchanged = 0;
+        const Array& volatilities = sigma_.params();
+        if (modelSettings_.incrementalCalibration_ &&
+            tabulatedNumeraire0_ == numeraire0 && tabulatedTimes_ == times_ &&
+            tabulatedVolatilities_.size() == volatilities.size() &&
+            std::equal(volatilities.begin(), volatilities.end(),
+                       tabulatedVolatilities_.begin())) {
+            for (auto i = calibrationPoints_.rbegin();
+                 i != calibrationPoints_.rend() && !i->second.smileChanged_;
+                 ++i)
+                ++unchanged;
+        }
+        tabulatedNumeraire0_ = Null<Real>();
+
+        if (unchanged > 0)
+            QL_MFMESSAGE(modelOutputs_, "keeping numeraire tabulation for "
+                                            << unchanged
+                                            << " calibration points");
+        modelOutputs_.recalibratedPoints_ =
+            calibrationPoints_.size() - unchanged;
+
+        modelOutputs_.adjustmentFactors_.erase(
+            modelOutputs_.adjustmentFactors_.begin(),
+            modelOutputs_.adjustmentFactors_.end() - unchanged);
+        modelOutputs_.digitalsAdjustmentFactors_.erase(
+            modelOutputs_.digitalsAdjustmentFactors_.begin(),
+            modelOutputs_.digitalsAdjustmentFactors_.end() - unchanged);
 
-        int idx = times_.size() - 2;
+        int idx = times_.size() - 2 - unchanged;
 
-        for (auto i = calibrationPoints_.rbegin(); i != calibrationPoints_.rend(); ++i, --idx) {
+        for (auto i = std::next(calibrationPoints_.rbegin(), unchanged);
+             i != calibrationPoints_.rend(); ++i, --idx) {
 
             ext::shared_ptr<CustomSmileSection> mfSec;
             if ((modelSettings_.adjustments_ & ModelSettings::CustomSmile) != 0) {
@@ -470,21 +559,38 @@ namespace QuantLib {
                            "no CustomSmileSection given, this is unexpected...");
             }
 
-            Array discreteDeflatedAnnuities(y_.size(), 0.0);
-            Array deflatedFinalPayments;
-
-            Real numeraire0 = termStructure()->discount(numeraireTime_, true);
             Real normalization =
                 termStructure()->discount(times_[idx], true) / numeraire0;
 
-            for (unsigned int k = 0; k < i->second.paymentDates_.size(); k++) {
-                deflatedFinalPayments =
-                    deflatedZerobondArray(termStructure()->timeFromReference(
-                                              i->second.paymentDates_[k]),
-                                          times_[idx], y_);
-                discreteDeflatedAnnuities +=
-                    deflatedFinalPayments * i->second.yearFractions_[k];
+            // the deflated zerobonds only read the numeraire tabulation on
+            // later calibration times, they are computed in parallel and
+            // summed up in the original order afterwards
+            const Size nPayments = i->second.paymentDates_.size();
+            std::vector<Time> paymentTimes(nPayments);
+            for (Size k = 0; k < nPayments; k++)
+                paymentTimes[k] = termStructure()->timeFromReference(
+                    i->second.paymentDates_[k]);
+            std::vector<Array> deflatedPayments(nPayments);
+            std::string error;
+
+            #pragma omp parallel for
+            for (long k = 0; k < (long)nPayments; k++) {
+                try {
+                    deflatedPayments[k] = deflatedZerobondArray(
+                        paymentTimes[k], times_[idx], y_);
+                }
+                catch (std::exception& e) {
+                    #pragma omp critical
+                    error = e.what();
+                }
             }
+            QL_REQUIRE(error.empty(), error);
+
+            Array discreteDeflatedAnnuities(y_.size(), 0.0);
+            for (Size k = 0; k < nPayments; k++)
+                discreteDeflatedAnnuities +=
+                    deflatedPayments[k] * i->second.yearFractions_[k];
+            const Array& deflatedFinalPayments = deflatedPayments.back();
 
             CubicInterpolation deflatedAnnuities(
                 y_.begin(), y_.end(), discreteDeflatedAnnuities.begin(),
@@ -492,6 +598,44 @@ namespace QuantLib {
                 0.0, CubicInterpolation::Lagrange, 0.0);
             deflatedAnnuities.enableExtrapolation();
 
+            // the integrals of the deflated annuity over the y-grid cells
+            // do not depend on the digitals correction, the market rates
+            // are then implied sequentially from the cumulative sums
+            const int nY = y_.size();
+            Array integrals(nY, 0.0);
+
+            #pragma omp parallel for
+            for (long l = 0; l < (long)nY; l++) {
+                const int j = (int)l;
+                if (j == nY - 1) {
+                    if ((modelSettings_.adjustments_ &
+                         ModelSettings::NoPayoffExtrapolation) == 0) {
+                        if ((modelSettings_.adjustments_ &
+                             ModelSettings::ExtrapolatePayoffFlat) != 0) {
+                            integrals[j] = gaussianShiftedPolynomialIntegral(
+                                0.0, 0.0, 0.0, 0.0,
+                                discreteDeflatedAnnuities[j - 1], y_[j - 1],
+                                y_[j], 100.0);
+                        } else {
+                            Real ca = deflatedAnnuities.aCoefficients()[j - 1];
+                            Real cb = deflatedAnnuities.bCoefficients()[j - 1];
+                            Real cc = deflatedAnnuities.cCoefficients()[j - 1];
+                            integrals[j] = gaussianShiftedPolynomialIntegral(
+                                0.0, cc, cb, ca,
+                                discreteDeflatedAnnuities[j - 1], y_[j - 1],
+                                y_[j], 100.0);
+                        }
+                    }
+                } else {
+                    Real ca = deflatedAnnuities.aCoefficients()[j];
+                    Real cb = deflatedAnnuities.bCoefficients()[j];
+                    Real cc = deflatedAnnuities.cCoefficients()[j];
+                    integrals[j] = gaussianShiftedPolynomialIntegral(
+                        0.0, cc, cb, ca, discreteDeflatedAnnuities[j], y_[j],
+                        y_[j], y_[j + 1]);
+                }
+            }
+
             Real digitalsCorrectionFactor = 1.0;
             modelOutputs_.digitalsAdjustmentFactors_.insert(
                 modelOutputs_.digitalsAdjustmentFactors_.begin(),
@@ -515,38 +659,7 @@ namespace QuantLib {
                     modelSettings_.upperRateBound_ / 2.0; // initial guess
                 for (int j = y_.size() - 1; j >= 0; j--) {
 
-                    Real integral = 0.0;
-
-                    if (j == (int)(y_.size() - 1)) {
-                        if ((modelSettings_.adjustments_ &
-                             ModelSettings::NoPayoffExtrapolation) == 0) {
-                            if ((modelSettings_.adjustments_ &
-                                 ModelSettings::ExtrapolatePayoffFlat) != 0) {
-                                integral = gaussianShiftedPolynomialIntegral(
-                                    0.0, 0.0, 0.0, 0.0,
-                                    discreteDeflatedAnnuities[j - 1], y_[j - 1],
-                                    y_[j], 100.0);
-                            } else {
-                                Real ca =
-                                    deflatedAnnuities.aCoefficients()[j - 1];
-                                Real cb =
-                                    deflatedAnnuities.bCoefficients()[j - 1];
-                                Real cc =
-                                    deflatedAnnuities.cCoefficients()[j - 1];
-                                integral = gaussianShiftedPolynomialIntegral(
-                                    0.0, cc, cb, ca,
-                                    discreteDeflatedAnnuities[j - 1], y_[j - 1],
-                                    y_[j], 100.0);
-                            }
-                        }
-                    } else {
-                        Real ca = deflatedAnnuities.aCoefficients()[j];
-                        Real cb = deflatedAnnuities.bCoefficients()[j];
-                        Real cc = deflatedAnnuities.cCoefficients()[j];
-                        integral = gaussianShiftedPolynomialIntegral(
-                            0.0, cc, cb, ca, discreteDeflatedAnnuities[j],
-                            y_[j], y_[j], y_[j + 1]);
-                    }
+                    Real integral = integrals[j];
 
                     if (integral < 0) {
                         QL_MFMESSAGE(modelOutputs_,
@@ -616,6 +729,12 @@ namespace QuantLib {
 
             numeraire_[idx]->update();
         }
+
+        for (auto& calibrationPoint : calibrationPoints_)
+            calibrationPoint.second.smileChanged_ = false;
+        tabulatedTimes_ = times_;
+        tabulatedVolatilities_ = volatilities;
+        tabulatedNumeraire0_ = numeraire0;
     }
 
     const MarkovFunctional::ModelOutputs &
@@ -772,15 +891,20 @@ namespace QuantLib {
         Real stdDev_0_T = stateProcess_->stdDeviation(0.0, 0.0, T);
         Real stdDev_t_T = stateProcess_->stdDeviation(t, 0.0, T - t);
 
+        // the numeraire is evaluated at all Gauss Hermite points for all
+        // y in one go, so that the interpolation in time is set up once
+        Size n = modelSettings_.gaussHermitePoints_;
+        Array ya(n * y.size());
         for (Size j = 0; j < y.size(); j++) {
-            Array ya(modelSettings_.gaussHermitePoints_);
-            for (Size i = 0; i < modelSettings_.gaussHermitePoints_; i++) {
-                ya[i] = (y[j] * stdDev_0_t + stdDev_t_T * normalIntegralX_[i]) /
-                        stdDev_0_T;
+            for (Size i = 0; i < n; i++) {
+                ya[j * n + i] = (y[j] * stdDev_0_t + stdDev_t_T * normalIntegralX_[i]) /
+                                stdDev_0_T;
             }
-            Array res = numeraireArray(T, ya);
-            for (Size i = 0; i < modelSettings_.gaussHermitePoints_; i++) {
-                result[j] += normalIntegralW_[i] / res[i];
+        }
+        Array res = numeraireArray(T, ya);
+        for (Size j = 0; j < y.size(); j++) {
+            for (Size i = 0; i < n; i++) {
+                result[j] += normalIntegralW_[i] / res[j * n + i];
             }
         }
 
@@ -818,6 +942,50 @@ namespace QuantLib {
                                      termStructure()->discount(T)));
     }
 
+    Disposable<Array> MarkovFunctional::numeraireImpl(
+        const Time t, const Array &y,
+        const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0) {
+            Array result(y.size(),
+                         yts.empty()
+                             ? this->termStructure()->discount(numeraireTime(), true)
+                             : yts->discount(numeraireTime()));
+            return result;
+        }
+
+        Array result = numeraireArray(t, y);
+        if (!yts.empty()) {
+            Real adjustment = yts->discount(numeraireTime()) / yts->discount(t) *
+                              termStructure()->discount(t) /
+                              termStructure()->discount(numeraireTime());
+            for (Real& r : result)
+                r *= adjustment;
+        }
+        return result;
+    }
+
+    Disposable<Array>
+    MarkovFunctional::zerobondImpl(const Time T, const Time t, const Array &y,
+                                   const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0.0) {
+            Array result(y.size(), yts.empty() ? this->termStructure()->discount(T, true)
+                                               : yts->discount(T, true));
+            return result;
+        }
+
+        Array result = zerobondArray(T, t, y);
+        if (!yts.empty()) {
+            Real adjustment = yts->discount(T) / yts->discount(t) *
+                              termStructure()->discount(t) /
+                              termStructure()->discount(T);
+            for (Real& r : result)
+                r *= adjustment;
+        }
+        return result;
+    }
+
     Real MarkovFunctional::deflatedZerobond(Time T, Time t,
                                             Real y) const {
 
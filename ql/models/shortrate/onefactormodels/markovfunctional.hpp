@@ -94,6 +94,18 @@ namespace QuantLib {
       digital prices to market rates, so digitalGap, marketRateAccuracy,
       lowerRateBound, upperRateBound are irrelavant and the smile moneyness
       checkpoints are only used for the debug model output in this setup.
+
+      With incremental calibration enabled, each calibration point keeps a
+      fingerprint of its market inputs (atm level, annuity, discount factors
+      and the raw smile's call prices on the moneyness checkpoint grid).
+      On recalculation, points whose fingerprint did not change keep their
+      pretreated smile section. Since the numeraire is calibrated backwards
+      in time, the tabulation of the trailing run of unchanged points is
+      kept as well, provided that the model volatilities and the time grid
+      did not change either. Only the earlier expiries, up to the latest
+      changed one, are then recalibrated. The results are identical to a
+      full recalibration as long as the smile sections are determined by
+      their values on the checkpoint grid.
     */
 
     class MarkovFunctional : public Gaussian1dModel, public CalibratedModel {
@@ -248,6 +260,10 @@ namespace QuantLib {
                 customSmileFactory_ = f;
                 return *this;
             }
+            ModelSettings &withIncrementalCalibration(bool b = true) {
+                incrementalCalibration_ = b;
+                return *this;
+            }
 
             Size yGridPoints_ = 64;
             Real yStdDevs_ = 7.0;
@@ -257,6 +273,7 @@ namespace QuantLib {
             int adjustments_;
             std::vector<Real> smileMoneynessCheckpoints_;
             ext::shared_ptr<CustomSmileFactory> customSmileFactory_;
+            bool incrementalCalibration_ = false;
         };
 
         struct CalibrationPoint {
@@ -270,6 +287,9 @@ namespace QuantLib {
             ext::shared_ptr<SmileSection> rawSmileSection_;
             Real minRateDigital_;
             Real maxRateDigital_;
+            // market inputs of the last smile update (incremental mode)
+            std::vector<Real> smileFingerprint_;
+            bool smileChanged_ = true;
         };
 
 // utility macro to write messages to the model outputs
@@ -301,6 +321,8 @@ namespace QuantLib {
             std::vector<std::vector<Real> > marketVega_;
             std::vector<Real> marketZerorate_;
             std::vector<Real> modelZerorate_;
+            // calibration points tabulated in the last numeraire update
+            Size recalibratedPoints_ = 0;
         };
 
         // Constructor for a swaption smile calibrated model
@@ -370,6 +392,8 @@ namespace QuantLib {
         // if an empty vector is given, the dynamic calculation is used again
         void forceArbitrageIndices(const std::vector<std::pair<Size,Size> >& indices) {
             forcedArbitrageIndices_ = indices;
+            for (auto& p : calibrationPoints_)
+                p.second.smileFingerprint_.clear();
             this->update();
         }
 
@@ -379,12 +403,22 @@ namespace QuantLib {
         Real
         zerobondImpl(Time T, Time t, Real y, const Handle<YieldTermStructure>& yts) const override;
 
+        Disposable<Array> numeraireImpl(Time t,
+                                        const Array& y,
+                                        const Handle<YieldTermStructure>& yts) const override;
+
+        Disposable<Array> zerobondImpl(Time T,
+                                       Time t,
+                                       const Array& y,
+                                       const Handle<YieldTermStructure>& yts) const override;
+
         void generateArguments() override {
             // if calculate triggers performCalculations, updateNumeraireTabulations
             // is called twice. If we can not check the lazy object status this seem
             // hard to avoid though.
             calculate();
             updateNumeraireTabulation();
+            flushGridCache();
             notifyObservers();
         }
 
@@ -410,6 +444,8 @@ namespace QuantLib {
 
         void updateSmiles() const;
         void updateNumeraireTabulation() const;
+        Disposable<std::vector<Real> >
+        smileFingerprint(const Date& expiry, const CalibrationPoint& p) const;
 
         void makeSwaptionCalibrationPoint(const Date &expiry,
                                           const Period &tenor);
@@ -537,6 +573,11 @@ namespace QuantLib {
 
         mutable std::vector<std::pair<Size,Size> > arbitrageIndices_;
         std::vector<std::pair<Size,Size> > forcedArbitrageIndices_;
+
+        // state of the last complete numeraire tabulation (incremental mode)
+        mutable std::vector<Real> tabulatedTimes_;
+        mutable Array tabulatedVolatilities_;
+        mutable Real tabulatedNumeraire0_ = Null<Real>();
     };
 
     std::ostream &operator<<(std::ostream &out,
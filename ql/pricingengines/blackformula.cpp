@@ -878,4 +878,214 @@ namespace QuantLib {
         return bachelierBlackFormulaAssetItmProbability(payoff->optionType(),
             payoff->strike(), forward, stdDev);
     }
+
+    namespace {
+
+        void checkSizes(const Array& strikes,
+                        const Array& forwards,
+                        const Array& third,
+                        const Array& discounts) {
+            QL_REQUIRE(forwards.size() == strikes.size(),
+                       "number of forwards (" << forwards.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+            QL_REQUIRE(third.size() == strikes.size(),
+                       "array size (" << third.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+            QL_REQUIRE(discounts.size() == strikes.size(),
+                       "number of discounts (" << discounts.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+        }
+
+        void resize(Array& a, Size n) {
+            if (a.size() != n)
+                Array(n).swap(a);
+        }
+
+    }
+
+    void blackFormula(Option::Type optionType,
+                      const Array& strikes,
+                      const Array& forwards,
+                      const Array& stdDevs,
+                      const Array& discounts,
+                      Real displacement,
+                      Array& values,
+                      Array* stdDevDerivatives,
+                      Array* assetItmProbabilities) {
+        checkSizes(strikes, forwards, stdDevs, discounts);
+        const Size n = strikes.size();
+        for (Size i=0; i<n; ++i) {
+            checkParameters(strikes[i], forwards[i], displacement);
+            QL_REQUIRE(stdDevs[i]>=0.0,
+                       "stdDev (" << stdDevs[i] << ") must be non-negative");
+            QL_REQUIRE(discounts[i]>0.0,
+                       "discount (" << discounts[i] << ") must be positive");
+        }
+
+        resize(values, n);
+        if (stdDevDerivatives != nullptr)
+            resize(*stdDevDerivatives, n);
+        if (assetItmProbabilities != nullptr)
+            resize(*assetItmProbabilities, n);
+
+        CumulativeNormalDistribution phi;
+        for (Size i=0; i<n; ++i) {
+            const Real stdDev = stdDevs[i], discount = discounts[i];
+            Real value, derivative = 0.0, probability;
+            if (stdDev==0.0) {
+                value = std::max((forwards[i]-strikes[i])*optionType,
+                                 Real(0.0))*discount;
+                derivative = 0.0;
+                probability = (forwards[i]*optionType < strikes[i]*optionType
+                               ? 1.0 : 0.0);
+            } else {
+                const Real forward = forwards[i] + displacement;
+                const Real strike = strikes[i] + displacement;
+                if (strike==0.0) {
+                    value = (optionType==Option::Call ? forward*discount : 0.0);
+                    derivative = 0.0;
+                    probability = (optionType==Option::Call ? 1.0 : 0.0);
+                } else {
+                    const Real d1 = std::log(forward/strike)/stdDev
+                                  + 0.5*stdDev;
+                    const Real d2 = d1 - stdDev;
+                    const Real nd1 = phi(optionType*d1);
+                    const Real nd2 = phi(optionType*d2);
+                    value = discount * optionType * (forward*nd1 - strike*nd2);
+                    QL_ENSURE(value>=0.0,
+                              "negative value (" << value << ") for " <<
+                              stdDev << " stdDev, " <<
+                              optionType << " option, " <<
+                              strike << " strike , " <<
+                              forward << " forward");
+                    if (stdDevDerivatives != nullptr)
+                        derivative = discount * forward * phi.derivative(d1);
+                    probability = nd1;
+                }
+            }
+            values[i] = value;
+            if (stdDevDerivatives != nullptr)
+                (*stdDevDerivatives)[i] = derivative;
+            if (assetItmProbabilities != nullptr)
+                (*assetItmProbabilities)[i] = probability;
+        }
+    }
+
+    void bachelierBlackFormula(Option::Type optionType,
+                               const Array& strikes,
+                               const Array& forwards,
+                               const Array& stdDevs,
+                               const Array& discounts,
+                               Array& values,
+                               Array* stdDevDerivatives,
+                               Array* assetItmProbabilities) {
+        checkSizes(strikes, forwards, stdDevs, discounts);
+        const Size n = strikes.size();
+        for (Size i=0; i<n; ++i) {
+            QL_REQUIRE(stdDevs[i]>=0.0,
+                       "stdDev (" << stdDevs[i] << ") must be non-negative");
+            QL_REQUIRE(discounts[i]>0.0,
+                       "discount (" << discounts[i] << ") must be positive");
+        }
+
+        resize(values, n);
+        if (stdDevDerivatives != nullptr)
+            resize(*stdDevDerivatives, n);
+        if (assetItmProbabilities != nullptr)
+            resize(*assetItmProbabilities, n);
+
+        CumulativeNormalDistribution phi;
+        for (Size i=0; i<n; ++i) {
+            const Real stdDev = stdDevs[i], discount = discounts[i];
+            const Real d = (forwards[i]-strikes[i])*optionType;
+            Real value, derivative = 0.0, probability;
+            if (stdDev==0.0) {
+                value = discount*std::max(d, 0.0);
+                derivative = 0.0;
+                probability = std::max(d, 0.0);
+            } else {
+                // the density is even, so it can be shared between
+                // calls and puts
+                const Real h = d/stdDev;
+                const Real density = phi.derivative(h);
+                const Real nh = phi(h);
+                value = discount*(stdDev*density + d*nh);
+                QL_ENSURE(value>=0.0,
+                          "negative value (" << value << ") for " <<
+                          stdDev << " stdDev, " <<
+                          optionType << " option, " <<
+                          strikes[i] << " strike , " <<
+                          forwards[i] << " forward");
+                derivative = discount*density;
+                probability = nh;
+            }
+            values[i] = value;
+            if (stdDevDerivatives != nullptr)
+                (*stdDevDerivatives)[i] = derivative;
+            if (assetItmProbabilities != nullptr)
+                (*assetItmProbabilities)[i] = probability;
+        }
+    }
+
+    Disposable<Array> blackFormulaImpliedStdDev(Option::Type optionType,
+                                                const Array& strikes,
+                                                const Array& forwards,
+                                                const Array& blackPrices,
+                                                const Array& discounts,
+                                                Real displacement,
+                                                const Array& guesses,
+                                                Real accuracy,
+                                                Natural maxIterations) {
+        checkSizes(strikes, forwards, blackPrices, discounts);
+        QL_REQUIRE(guesses.empty() || guesses.size() == strikes.size(),
+                   "number of guesses (" << guesses.size()
+                   << ") differs from number of strikes ("
+                   << strikes.size() << ")");
+        const Size n = strikes.size();
+        Array result(n);
+        std::string error;
+        #pragma omp parallel for
+        for (long i=0; i<static_cast<long>(n); ++i) {
+            try {
+                result[i] = blackFormulaImpliedStdDev(
+                    optionType, strikes[i], forwards[i], blackPrices[i],
+                    discounts[i], displacement,
+                    guesses.empty() ? Null<Real>() : guesses[i],
+                    accuracy, maxIterations);
+            } catch (std::exception& e) {
+                #pragma omp critical
+                {
+                    if (error.empty())
+                        error = e.what();
+                }
+            }
+        }
+        QL_REQUIRE(error.empty(), error);
+        return result;
+    }
+
+    Disposable<Array> bachelierBlackFormulaImpliedVol(
+                                            Option::Type optionType,
+                                            const Array& strikes,
+                                            const Array& forwards,
+                                            const Array& ttes,
+                                            const Array& bachelierPrices,
+                                            const Array& discounts) {
+        checkSizes(strikes, forwards, bachelierPrices, discounts);
+        QL_REQUIRE(ttes.size() == strikes.size(),
+                   "number of times (" << ttes.size()
+                   << ") differs from number of strikes ("
+                   << strikes.size() << ")");
+        const Size n = strikes.size();
+        Array result(n);
+        for (Size i=0; i<n; ++i)
+            result[i] = bachelierBlackFormulaImpliedVol(
+                optionType, strikes[i], forwards[i], ttes[i],
+                bachelierPrices[i], discounts[i]);
+        return result;
+    }
+
 }
@@ -36,6 +36,7 @@
 
 #include <ql/instruments/payoffs.hpp>
 #include <ql/option.hpp>
+#include <ql/math/array.hpp>
 
 namespace QuantLib {
 
@@ -407,6 +408,69 @@ namespace QuantLib {
                                                   Real forward,
                                                   Real stdDev);
 
+    /*! \name Batched formulas
+        The following functions apply the corresponding scalar
+        formulas to a set of options of the same type, the i-th option
+        being described by the i-th element of each input array.
+        Results are the same as the ones returned by the scalar
+        functions; however, the arguments are checked once in a
+        separate pass and each option's d1, d2 and normal integrals
+        are evaluated once and shared among price, standard-deviation
+        derivative and asset in-the-money probability, which makes
+        them the preferred choice for pricing whole cap/floor legs
+        or optionlet grids.
+
+        Optional outputs are skipped when the corresponding pointer
+        is null.
+    */
+    //@{
+    //! Black 1976 formula with optional vega and asset ITM probability
+    void blackFormula(Option::Type optionType,
+                      const Array& strikes,
+                      const Array& forwards,
+                      const Array& stdDevs,
+                      const Array& discounts,
+                      Real displacement,
+                      Array& values,
+                      Array* stdDevDerivatives = nullptr,
+                      Array* assetItmProbabilities = nullptr);
+
+    //! Bachelier formula with optional vega and asset ITM probability
+    void bachelierBlackFormula(Option::Type optionType,
+                               const Array& strikes,
+                               const Array& forwards,
+                               const Array& stdDevs,
+                               const Array& discounts,
+                               Array& values,
+                               Array* stdDevDerivatives = nullptr,
+                               Array* assetItmProbabilities = nullptr);
+
+    /*! Black 1976 implied standard deviations.  The root searches are
+        independent and run in parallel when OpenMP is enabled; an
+        empty \p guesses array uses the default guess for each option.
+    */
+    Disposable<Array> blackFormulaImpliedStdDev(
+                                        Option::Type optionType,
+                                        const Array& strikes,
+                                        const Array& forwards,
+                                        const Array& blackPrices,
+                                        const Array& discounts,
+                                        Real displacement = 0.0,
+                                        const Array& guesses = Array(),
+                                        Real accuracy = 1.0e-6,
+                                        Natural maxIterations = 100);
+
+    //! Approximated Bachelier implied volatilities
+    Disposable<Array> bachelierBlackFormulaImpliedVol(
+                                        Option::Type optionType,
+                                        const Array& strikes,
+                                        const Array& forwards,
+                                        const Array& ttes,
+                                        const Array& bachelierPrices,
+                                        const Array& discounts);
+    //@}
+
 }
 
+
 #endif
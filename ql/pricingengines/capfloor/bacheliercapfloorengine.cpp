@@ -72,70 +72,98 @@ namespace QuantLib {
         Date today = vol_->referenceDate();
         Date settlement = discountCurve_->referenceDate();
 
+        // handling of settlementDate, npvDate and includeSettlementFlows
+        // should be implemented.
+        // For the time being just discard expired caplets
+        std::vector<Size> alive;
         for (Size i=0; i<optionlets; ++i) {
-            Date paymentDate = arguments_.endDates[i];
-            // handling of settlementDate, npvDate and includeSettlementFlows
-            // should be implemented.
-            // For the time being just discard expired caplets
-            if (paymentDate > settlement) {
-                DiscountFactor d = discountCurve_->discount(paymentDate);
-                discountFactors[i] = d;
-                Real accrualFactor = arguments_.nominals[i] *
-                                   arguments_.gearings[i] *
-                                   arguments_.accrualTimes[i];
-                Real discountedAccrual = d * accrualFactor;
-
-                Rate forward = arguments_.forwards[i];
-
-                Date fixingDate = arguments_.fixingDates[i];
-                Time sqrtTime = 0.0;
-                if (fixingDate > today)
-                    sqrtTime = std::sqrt(vol_->timeFromReference(fixingDate));
-
-                if (type == CapFloor::Cap || type == CapFloor::Collar) {
-                    Rate strike = arguments_.capRates[i];
-                    if (sqrtTime>0.0) {
-                        stdDevs[i] = std::sqrt(vol_->blackVariance(fixingDate,
-                                                                   strike));
-                        vegas[i] = bachelierBlackFormulaStdDevDerivative(strike,
-                            forward, stdDevs[i], discountedAccrual) * sqrtTime;
-                        deltas[i] = bachelierBlackFormulaAssetItmProbability(Option::Call,
-                            strike, forward, stdDevs[i]);
-                    }
-                    // include caplets with past fixing date
-                    values[i] = bachelierBlackFormula(Option::Call,
-                        strike, forward, stdDevs[i], discountedAccrual);
+            if (arguments_.endDates[i] > settlement)
+                alive.push_back(i);
+        }
+        Size n = alive.size();
+
+        // market data are collected first, so that each leg can then
+        // be priced in a single call to the batched formula
+        Array forwards(n), discountedAccruals(n), sqrtTimes(n, 0.0);
+        for (Size k=0; k<n; ++k) {
+            Size i = alive[k];
+            DiscountFactor d = discountCurve_->discount(arguments_.endDates[i]);
+            discountFactors[i] = d;
+            Real accrualFactor = arguments_.nominals[i] *
+                               arguments_.gearings[i] *
+                               arguments_.accrualTimes[i];
+            discountedAccruals[k] = d * accrualFactor;
+            forwards[k] = arguments_.forwards[i];
+
+            Date fixingDate = arguments_.fixingDates[i];
+            if (fixingDate > today)
+                sqrtTimes[k] = std::sqrt(vol_->timeFromReference(fixingDate));
+        }
+
+        Array strikes(n), legStdDevs(n), legValues, legVegas, legDeltas;
+
+        if (type == CapFloor::Cap || type == CapFloor::Collar) {
+            for (Size k=0; k<n; ++k) {
+                Size i = alive[k];
+                strikes[k] = arguments_.capRates[i];
+                legStdDevs[k] = sqrtTimes[k] > 0.0 ?
+                    std::sqrt(vol_->blackVariance(arguments_.fixingDates[i],
+                                                  strikes[k])) :
+                    0.0;
+            }
+            // include caplets with past fixing date
+            bachelierBlackFormula(Option::Call, strikes, forwards, legStdDevs,
+                                  discountedAccruals, legValues,
+                                  &legVegas, &legDeltas);
+            for (Size k=0; k<n; ++k) {
+                Size i = alive[k];
+                stdDevs[i] = legStdDevs[k];
+                values[i] = legValues[k];
+                if (sqrtTimes[k] > 0.0) {
+                    vegas[i] = legVegas[k] * sqrtTimes[k];
+                    deltas[i] = legDeltas[k];
                 }
-                if (type == CapFloor::Floor || type == CapFloor::Collar) {
-                    Rate strike = arguments_.floorRates[i];
-                    Real floorletVega = 0.0;
-                    Real floorletDelta = 0.0;
-                    if (sqrtTime>0.0) {
-                        stdDevs[i] = std::sqrt(vol_->blackVariance(fixingDate,
-                                                                   strike));
-                        floorletVega = bachelierBlackFormulaStdDevDerivative(strike,
-                            forward, stdDevs[i], discountedAccrual) * sqrtTime;
-                        floorletDelta = Option::Put * bachelierBlackFormulaAssetItmProbability(
-                                                        Option::Put, strike, forward, 
-                                                        stdDevs[i]);
-                    }
-                    Real floorlet = bachelierBlackFormula(Option::Put,
-                        strike, forward, stdDevs[i], discountedAccrual);
-                    if (type == CapFloor::Floor) {
-                        values[i] = floorlet;
-                        vegas[i] = floorletVega;
-                        deltas[i] = floorletDelta;
-                    } else {
-                        // a collar is long a cap and short a floor
-                        values[i] -= floorlet;
-                        vegas[i] -= floorletVega;
-                        deltas[i] -= floorletDelta;
-                    }
+            }
+        }
+        if (type == CapFloor::Floor || type == CapFloor::Collar) {
+            for (Size k=0; k<n; ++k) {
+                Size i = alive[k];
+                strikes[k] = arguments_.floorRates[i];
+                legStdDevs[k] = sqrtTimes[k] > 0.0 ?
+                    std::sqrt(vol_->blackVariance(arguments_.fixingDates[i],
+                                                  strikes[k])) :
+                    0.0;
+            }
+            bachelierBlackFormula(Option::Put, strikes, forwards, legStdDevs,
+                                  discountedAccruals, legValues,
+                                  &legVegas, &legDeltas);
+            for (Size k=0; k<n; ++k) {
+                Size i = alive[k];
+                stdDevs[i] = legStdDevs[k];
+                Real floorlet = legValues[k];
+                Real floorletVega = 0.0;
+                Real floorletDelta = 0.0;
+                if (sqrtTimes[k] > 0.0) {
+                    floorletVega = legVegas[k] * sqrtTimes[k];
+                    floorletDelta = Option::Put * legDeltas[k];
+                }
+                if (type == CapFloor::Floor) {
+                    values[i] = floorlet;
+                    vegas[i] = floorletVega;
+                    deltas[i] = floorletDelta;
+                } else {
+                    // a collar is long a cap and short a floor
+                    values[i] -= floorlet;
+                    vegas[i] -= floorletVega;
+                    deltas[i] -= floorletDelta;
                 }
-                value += values[i];
-                vega += vegas[i];
             }
         }
+
+        for (Size k=0; k<n; ++k) {
+            value += values[alive[k]];
+            vega += vegas[alive[k]];
+        }
         results_.value = value;
         results_.additionalResults["vega"] = vega;
 
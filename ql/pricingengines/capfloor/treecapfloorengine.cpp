@@ -65,7 +65,7 @@ namespace QuantLib {
         } else {
             std::vector<Time> times = capfloor.mandatoryTimes();
             TimeGrid timeGrid(times.begin(), times.end(), timeSteps_);
-            lattice = model_->tree(timeGrid);
+            lattice = model_->cachedTree(timeGrid);
         }
 
         Time firstTime = dayCounter.yearFraction(referenceDate,
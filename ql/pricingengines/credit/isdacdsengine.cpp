@@ -28,327 +28,534 @@
 #include <ql/termstructures/yield/piecewiseyieldcurve.hpp>
 #include <ql/time/calendars/weekendsonly.hpp>
 #include <ql/time/daycounters/actual360.hpp>
+#include <map>
 #include <utility>
 
 namespace QuantLib {
 
-    IsdaCdsEngine::IsdaCdsEngine(Handle<DefaultProbabilityTermStructure> probability,
-                                 Real recoveryRate,
-                                 Handle<YieldTermStructure> discountCurve,
-                                 const boost::optional<bool>& includeSettlementDateFlows,
-                                 const NumericalFix numericalFix,
-                                 const AccrualBias accrualBias,
-                                 const ForwardsInCouponPeriod forwardsInCouponPeriod)
-    : probability_(std::move(probability)), recoveryRate_(recoveryRate),
-      discountCurve_(std::move(discountCurve)),
-      includeSettlementDateFlows_(includeSettlementDateFlows), numericalFix_(numericalFix),
-      accrualBias_(accrualBias), forwardsInCouponPeriod_(forwardsInCouponPeriod) {
-
-        registerWith(probability_);
-        registerWith(discountCurve_);
-    }
-
-    void IsdaCdsEngine::calculate() const {
-
-        QL_REQUIRE(numericalFix_ == None || numericalFix_ == Taylor,
-                   "numerical fix must be None or Taylor");
-        QL_REQUIRE(accrualBias_ == HalfDayBias || accrualBias_ == NoBias,
-                   "accrual bias must be HalfDayBias or NoBias");
-        QL_REQUIRE(forwardsInCouponPeriod_ == Flat ||
-                       forwardsInCouponPeriod_ == Piecewise,
-                   "forwards in coupon period must be Flat or Piecewise");
-
-        // it would be possible to handle the cases which are excluded below,
-        // but the ISDA engine is not explicitly specified to handle them,
-        // so we just forbid them too
-
-        Actual365Fixed dc;
-        Actual360 dc1;
-        Actual360 dc2(true);
-
-        Date evalDate = Settings::instance().evaluationDate();
-
-        // check if given curves are ISDA compatible
-        // (the interpolation is checked below)
-
-        QL_REQUIRE(!discountCurve_.empty(), "no discount term structure set");
-        QL_REQUIRE(!probability_.empty(), "no probability term structure set");
-        QL_REQUIRE(discountCurve_->dayCounter() == dc,
-                   "yield term structure day counter ("
-                       << discountCurve_->dayCounter()
-                       << ") should be Act/365(Fixed)");
-        QL_REQUIRE(probability_->dayCounter() == dc,
-                   "probability term structure day counter ("
-                       << probability_->dayCounter() << ") should be "
-                       << "Act/365(Fixed)");
-        QL_REQUIRE(discountCurve_->referenceDate() == evalDate,
-                   "yield term structure reference date ("
-                       << discountCurve_->referenceDate()
-                       << " should be evaluation date (" << evalDate << ")");
-        QL_REQUIRE(probability_->referenceDate() == evalDate,
-                   "probability term structure reference date ("
-                       << probability_->referenceDate()
-                       << " should be evaluation date (" << evalDate << ")");
-        QL_REQUIRE(arguments_.settlesAccrual,
-                   "ISDA engine not compatible with non accrual paying CDS");
-        QL_REQUIRE(arguments_.paysAtDefaultTime,
-                   "ISDA engine not compatible with end period payment");
-        QL_REQUIRE(ext::dynamic_pointer_cast<FaceValueClaim>(arguments_.claim) != nullptr,
-                   "ISDA engine not compatible with non face value claim");
-
-        Date maturity = arguments_.maturity;
-        Date effectiveProtectionStart =
-            std::max<Date>(arguments_.protectionStart, evalDate + 1);
-
-        // collect nodes from both curves and sort them
-        std::vector<Date> yDates, cDates;
-
-        if(ext::shared_ptr<InterpolatedDiscountCurve<LogLinear> > castY1 =
-            ext::dynamic_pointer_cast<
-                InterpolatedDiscountCurve<LogLinear> >(*discountCurve_)) {
-            yDates = castY1->dates();
-        } else if(ext::shared_ptr<InterpolatedForwardCurve<BackwardFlat> >
-        castY2 = ext::dynamic_pointer_cast<
-            InterpolatedForwardCurve<BackwardFlat> >(*discountCurve_)) {
-            yDates = castY2->dates();
-        } else if(ext::shared_ptr<InterpolatedForwardCurve<ForwardFlat> >
-        castY3 = ext::dynamic_pointer_cast<
-            InterpolatedForwardCurve<ForwardFlat> >(*discountCurve_)) {
-            yDates = castY3->dates();
-        } else if(ext::shared_ptr<FlatForward> castY4 =
-            ext::dynamic_pointer_cast<FlatForward>(*discountCurve_)) {
-            // no dates to extract
-        } else {
-            QL_FAIL("Yield curve must be flat forward interpolated");
-        }
-
-        if(ext::shared_ptr<InterpolatedSurvivalProbabilityCurve<LogLinear> >
-        castC1 = ext::dynamic_pointer_cast<
-            InterpolatedSurvivalProbabilityCurve<LogLinear> >(
-            *probability_)) {
-            cDates = castC1->dates();
-        } else if(
-        ext::shared_ptr<InterpolatedHazardRateCurve<BackwardFlat> > castC2 =
-            ext::dynamic_pointer_cast<
-            InterpolatedHazardRateCurve<BackwardFlat> >(*probability_)) {
-            cDates = castC2->dates();
-        } else if(
-        ext::shared_ptr<FlatHazardRate> castC3 =
-            ext::dynamic_pointer_cast<FlatHazardRate>(*probability_)) {
-            // no dates to extract
-        } else{
-            QL_FAIL("Credit curve must be flat forward interpolated");
+    namespace {
+
+        /* Times, discount factors and their logarithms by date. A single
+           cache is shared by all the swaps priced together, so that the
+           discount curve is queried once per date for the whole set.
+        */
+        class IsdaDiscounts {
+          public:
+            struct Point {
+                Time time;
+                DiscountFactor discount, logDiscount;
+            };
+            explicit IsdaDiscounts(const YieldTermStructure& discountCurve)
+            : discountCurve_(discountCurve) {}
+            const Point& operator()(const Date& d) {
+                auto it = points_.lower_bound(d);
+                if (it == points_.end() || it->first != d) {
+                    DiscountFactor P = discountCurve_.discount(d);
+                    Point p = {discountCurve_.timeFromReference(d), P,
+                               std::log(P)};
+                    it = points_.insert(it, std::make_pair(d, p));
+                }
+                return it->second;
+            }
+          private:
+            const YieldTermStructure& discountCurve_;
+            std::map<Date, Point> points_;
+        };
+
+        /* Discount factors, survival probabilities and their logarithms on
+           the sorted union of all the dates used by the engine. Both legs
+           integrate over intervals sharing their end points, so querying
+           the curves once per date (rather than once per interval end)
+           halves the curve evaluations, which dominate the pricing and,
+           through it, the bootstrap of the credit curve.
+        */
+        class IsdaGrid {
+          public:
+            IsdaGrid(std::vector<Date> dates,
+                     IsdaDiscounts& discounts,
+                     const DefaultProbabilityTermStructure& probability)
+            : dates_(std::move(dates)) {
+                std::sort(dates_.begin(), dates_.end());
+                dates_.erase(std::unique(dates_.begin(), dates_.end()),
+                             dates_.end());
+                Size n = dates_.size();
+                times_.resize(n);
+                P_.resize(n);
+                Q_.resize(n);
+                logP_.resize(n);
+                logQ_.resize(n);
+                for (Size i=0; i<n; ++i) {
+                    const IsdaDiscounts::Point& p = discounts(dates_[i]);
+                    times_[i] = p.time;
+                    P_[i] = p.discount;
+                    logP_[i] = p.logDiscount;
+                    Q_[i] = probability.survivalProbability(dates_[i]);
+                    logQ_[i] = std::log(Q_[i]);
+                }
+            }
+            Size index(const Date& d) const {
+                auto it = std::lower_bound(dates_.begin(), dates_.end(), d);
+                QL_REQUIRE(it != dates_.end() && *it == d,
+                           "date " << d << " not in ISDA integration grid");
+                return it - dates_.begin();
+            }
+            Time time(Size i) const { return times_[i]; }
+            DiscountFactor discount(Size i) const { return P_[i]; }
+            Probability survival(Size i) const { return Q_[i]; }
+            Real logDiscount(Size i) const { return logP_[i]; }
+            Real logSurvival(Size i) const { return logQ_[i]; }
+          private:
+            std::vector<Date> dates_;
+            std::vector<Time> times_;
+            std::vector<Real> P_, Q_, logP_, logQ_;
+        };
+
+        void checkFlags(IsdaCdsEngine::NumericalFix numericalFix,
+                        IsdaCdsEngine::AccrualBias accrualBias,
+                        IsdaCdsEngine::ForwardsInCouponPeriod
+                                                    forwardsInCouponPeriod) {
+            QL_REQUIRE(numericalFix == IsdaCdsEngine::None ||
+                           numericalFix == IsdaCdsEngine::Taylor,
+                       "numerical fix must be None or Taylor");
+            QL_REQUIRE(accrualBias == IsdaCdsEngine::HalfDayBias ||
+                           accrualBias == IsdaCdsEngine::NoBias,
+                       "accrual bias must be HalfDayBias or NoBias");
+            QL_REQUIRE(forwardsInCouponPeriod == IsdaCdsEngine::Flat ||
+                           forwardsInCouponPeriod == IsdaCdsEngine::Piecewise,
+                       "forwards in coupon period must be Flat or Piecewise");
         }
 
-        std::vector<Date> nodes;
-        std::set_union(yDates.begin(), yDates.end(), cDates.begin(), cDates.end(), std::back_inserter(nodes));
-
-
-        if(nodes.empty()){
-            nodes.push_back(maturity);
-        }
-        const Real nFix = (numericalFix_ == None ? 1E-50 : 0.0);
-
-        // protection leg pricing (npv is always negative at this stage)
-        Real protectionNpv = 0.0;
-
-        Date d0 = effectiveProtectionStart-1;
-        Real P0 = discountCurve_->discount(d0);
-        Real Q0 = probability_->survivalProbability(d0);
-        Date d1;
-        std::vector<Date>::const_iterator it =
-            std::upper_bound(nodes.begin(), nodes.end(), effectiveProtectionStart);
-
-        for(;it != nodes.end(); ++it) {
-            if(*it > maturity) {
-                d1 = maturity;
-                it = nodes.end() - 1; //early exit
+        // checks the discount curve is ISDA compatible and returns its nodes
+        std::vector<Date> discountNodes(
+                              const Handle<YieldTermStructure>& discountCurve) {
+
+            // it would be possible to handle the cases which are excluded
+            // below, but the ISDA engine is not explicitly specified to
+            // handle them, so we just forbid them too
+
+            QL_REQUIRE(!discountCurve.empty(),
+                       "no discount term structure set");
+            QL_REQUIRE(discountCurve->dayCounter() == Actual365Fixed(),
+                       "yield term structure day counter ("
+                           << discountCurve->dayCounter()
+                           << ") should be Act/365(Fixed)");
+            Date evalDate = Settings::instance().evaluationDate();
+            QL_REQUIRE(discountCurve->referenceDate() == evalDate,
+                       "yield term structure reference date ("
+                           << discountCurve->referenceDate()
+                           << " should be evaluation date (" << evalDate << ")");
+
+            std::vector<Date> yDates;
+            if(ext::shared_ptr<InterpolatedDiscountCurve<LogLinear> > castY1 =
+                ext::dynamic_pointer_cast<
+                    InterpolatedDiscountCurve<LogLinear> >(*discountCurve)) {
+                yDates = castY1->dates();
+            } else if(ext::shared_ptr<InterpolatedForwardCurve<BackwardFlat> >
+            castY2 = ext::dynamic_pointer_cast<
+                InterpolatedForwardCurve<BackwardFlat> >(*discountCurve)) {
+                yDates = castY2->dates();
+            } else if(ext::shared_ptr<InterpolatedForwardCurve<ForwardFlat> >
+            castY3 = ext::dynamic_pointer_cast<
+                InterpolatedForwardCurve<ForwardFlat> >(*discountCurve)) {
+                yDates = castY3->dates();
+            } else if(ext::shared_ptr<FlatForward> castY4 =
+                ext::dynamic_pointer_cast<FlatForward>(*discountCurve)) {
+                // no dates to extract
             } else {
-                d1 = *it;
+                QL_FAIL("Yield curve must be flat forward interpolated");
             }
-            Real P1 = discountCurve_->discount(d1);
-            Real Q1 = probability_->survivalProbability(d1);
-
-            Real fhat = std::log(P0) - std::log(P1);
-            Real hhat = std::log(Q0) - std::log(Q1);
-            Real fhphh = fhat + hhat;
-
-            if (fhphh < 1E-4 && numericalFix_ == Taylor) {
-                Real fhphhq = fhphh * fhphh;
-                protectionNpv +=
-                    P0 * Q0 * hhat * (1.0 - 0.5 * fhphh + 1.0 / 6.0 * fhphhq -
-                                      1.0 / 24.0 * fhphhq * fhphh +
-                                      1.0 / 120 * fhphhq * fhphhq);
-            } else {
-                protectionNpv += hhat / (fhphh + nFix) * (P0 * Q0 - P1 * Q1);
+            return yDates;
+        }
+
+        // checks the credit curve is ISDA compatible and returns its nodes
+        std::vector<Date> creditNodes(
+                const Handle<DefaultProbabilityTermStructure>& probability) {
+
+            QL_REQUIRE(!probability.empty(),
+                       "no probability term structure set");
+            QL_REQUIRE(probability->dayCounter() == Actual365Fixed(),
+                       "probability term structure day counter ("
+                           << probability->dayCounter() << ") should be "
+                           << "Act/365(Fixed)");
+            Date evalDate = Settings::instance().evaluationDate();
+            QL_REQUIRE(probability->referenceDate() == evalDate,
+                       "probability term structure reference date ("
+                           << probability->referenceDate()
+                           << " should be evaluation date (" << evalDate << ")");
+
+            std::vector<Date> cDates;
+            if(ext::shared_ptr<InterpolatedSurvivalProbabilityCurve<LogLinear> >
+            castC1 = ext::dynamic_pointer_cast<
+                InterpolatedSurvivalProbabilityCurve<LogLinear> >(
+                *probability)) {
+                cDates = castC1->dates();
+            } else if(
+            ext::shared_ptr<InterpolatedHazardRateCurve<BackwardFlat> > castC2 =
+                ext::dynamic_pointer_cast<
+                InterpolatedHazardRateCurve<BackwardFlat> >(*probability)) {
+                cDates = castC2->dates();
+            } else if(
+            ext::shared_ptr<FlatHazardRate> castC3 =
+                ext::dynamic_pointer_cast<FlatHazardRate>(*probability)) {
+                // no dates to extract
+            } else{
+                QL_FAIL("Credit curve must be flat forward interpolated");
             }
-            d0 = d1;
-            P0 = P1;
-            Q0 = Q1;
+            return cDates;
         }
-        protectionNpv *= arguments_.claim->amount(
-            Null<Date>(), arguments_.notional, recoveryRate_);
 
-        results_.defaultLegNPV = protectionNpv;
+        /* Prices a single swap. The curves are assumed to be checked
+           already and their nodes are passed in, so that pricing several
+           swaps on the same discount curve does not repeat the work. */
+        void isdaCalculate(
+                const CreditDefaultSwap::arguments& arguments,
+                const DefaultProbabilityTermStructure& probability,
+                const std::vector<Date>& cDates,
+                Real recoveryRate,
+                const YieldTermStructure& discountCurve,
+                const std::vector<Date>& yDates,
+                IsdaDiscounts& discounts,
+                const boost::optional<bool>& includeSettlementDateFlows,
+                IsdaCdsEngine::NumericalFix numericalFix,
+                IsdaCdsEngine::AccrualBias accrualBias,
+                IsdaCdsEngine::ForwardsInCouponPeriod forwardsInCouponPeriod,
+                CreditDefaultSwap::results& results) {
+
+            Actual365Fixed dc;
+            Actual360 dc1;
+            Actual360 dc2(true);
+
+            Date evalDate = Settings::instance().evaluationDate();
+
+            QL_REQUIRE(arguments.settlesAccrual,
+                       "ISDA engine not compatible with non accrual paying CDS");
+            QL_REQUIRE(arguments.paysAtDefaultTime,
+                       "ISDA engine not compatible with end period payment");
+            QL_REQUIRE(ext::dynamic_pointer_cast<FaceValueClaim>(arguments.claim) != nullptr,
+                       "ISDA engine not compatible with non face value claim");
+
+            Date maturity = arguments.maturity;
+            Date effectiveProtectionStart =
+                std::max<Date>(arguments.protectionStart, evalDate + 1);
+
+            std::vector<Date> nodes;
+            std::set_union(yDates.begin(), yDates.end(), cDates.begin(), cDates.end(), std::back_inserter(nodes));
+
+
+            if(nodes.empty()){
+                nodes.push_back(maturity);
+            }
+            const Real nFix = (numericalFix == IsdaCdsEngine::None ? 1E-50 : 0.0);
+
+            // build the integration grid: every date at which the legs below
+            // need a discount factor or a survival probability
+            std::vector<Date> gridDates;
+            Date d0 = effectiveProtectionStart-1;
+            gridDates.push_back(d0);
+            gridDates.push_back(maturity);
+            for (auto& i : arguments.leg) {
+                if (!i->hasOccurred(effectiveProtectionStart, includeSettlementDateFlows)) {
+                    gridDates.push_back(i->date());
+                    gridDates.push_back(i->date()-1);
+                }
+                ext::shared_ptr<FixedRateCoupon> coupon = ext::dynamic_pointer_cast<FixedRateCoupon>(i);
+                if (coupon != nullptr &&
+                    !detail::simple_event(coupon->accrualEndDate())
+                         .hasOccurred(effectiveProtectionStart, false)) {
+                    gridDates.push_back(std::max<Date>(coupon->accrualStartDate(),
+                                                       effectiveProtectionStart)-1);
+                    gridDates.push_back(coupon->date()-1);
+                }
+            }
+            Date lastGridDate = *std::max_element(gridDates.begin(), gridDates.end());
+            for (auto node : nodes) {
+                if (node > d0 && node < lastGridDate)
+                    gridDates.push_back(node);
+            }
+            const IsdaGrid grid(std::move(gridDates), discounts, probability);
+
+            // protection leg pricing (npv is always negative at this stage)
+            Real protectionNpv = 0.0;
+
+            Size i0 = grid.index(d0);
+            Real P0 = grid.discount(i0);
+            Real Q0 = grid.survival(i0);
+            Date d1;
+            std::vector<Date>::const_iterator it =
+                std::upper_bound(nodes.begin(), nodes.end(), effectiveProtectionStart);
+
+            for(;it != nodes.end(); ++it) {
+                if(*it > maturity) {
+                    d1 = maturity;
+                    it = nodes.end() - 1; //early exit
+                } else {
+                    d1 = *it;
+                }
+                Size i1 = grid.index(d1);
+                Real P1 = grid.discount(i1);
+                Real Q1 = grid.survival(i1);
+
+                Real fhat = grid.logDiscount(i0) - grid.logDiscount(i1);
+                Real hhat = grid.logSurvival(i0) - grid.logSurvival(i1);
+                Real fhphh = fhat + hhat;
+
+                if (fhphh < 1E-4 && numericalFix == IsdaCdsEngine::Taylor) {
+                    Real fhphhq = fhphh * fhphh;
+                    protectionNpv +=
+                        P0 * Q0 * hhat * (1.0 - 0.5 * fhphh + 1.0 / 6.0 * fhphhq -
+                                          1.0 / 24.0 * fhphhq * fhphh +
+                                          1.0 / 120 * fhphhq * fhphhq);
+                } else {
+                    protectionNpv += hhat / (fhphh + nFix) * (P0 * Q0 - P1 * Q1);
+                }
+                i0 = i1;
+                P0 = P1;
+                Q0 = Q1;
+            }
+            protectionNpv *= arguments.claim->amount(
+                Null<Date>(), arguments.notional, recoveryRate);
 
-        // premium leg pricing (npv is always positive at this stage)
+            results.defaultLegNPV = protectionNpv;
 
-        Real premiumNpv = 0.0, defaultAccrualNpv = 0.0;
-        for (auto& i : arguments_.leg) {
-            ext::shared_ptr<FixedRateCoupon> coupon = ext::dynamic_pointer_cast<FixedRateCoupon>(i);
+            // premium leg pricing (npv is always positive at this stage)
 
-            QL_REQUIRE(coupon->dayCounter() == dc ||
-                           coupon->dayCounter() == dc1 ||
-                           coupon->dayCounter() == dc2,
-                       "ISDA engine requires a coupon day counter Act/365Fixed "
-                           << "or Act/360 (" << coupon->dayCounter() << ")");
+            Real premiumNpv = 0.0, defaultAccrualNpv = 0.0;
+            for (auto& i : arguments.leg) {
+                ext::shared_ptr<FixedRateCoupon> coupon = ext::dynamic_pointer_cast<FixedRateCoupon>(i);
 
-            // premium coupons
-            if (!i->hasOccurred(effectiveProtectionStart, includeSettlementDateFlows_)) {
-                premiumNpv +=
-                    coupon->amount() *
-                    discountCurve_->discount(coupon->date()) *
-                    probability_->survivalProbability(coupon->date()-1);
-            }
+                QL_REQUIRE(coupon->dayCounter() == dc ||
+                               coupon->dayCounter() == dc1 ||
+                               coupon->dayCounter() == dc2,
+                           "ISDA engine requires a coupon day counter Act/365Fixed "
+                               << "or Act/360 (" << coupon->dayCounter() << ")");
 
-            // default accruals
-
-            if (!detail::simple_event(coupon->accrualEndDate())
-                     .hasOccurred(effectiveProtectionStart, false)) {
-                Date start = std::max<Date>(coupon->accrualStartDate(),
-                                            effectiveProtectionStart)-1;
-                Date end = coupon->date()-1;
-                Real tstart =
-                    discountCurve_->timeFromReference(coupon->accrualStartDate()-1) -
-                    (accrualBias_ == HalfDayBias ? 1.0 / 730.0 : 0.0);
-                std::vector<Date> localNodes;
-                localNodes.push_back(start);
-                //add intermediary nodes, if any
-                if (forwardsInCouponPeriod_ == Piecewise) {
-                    std::vector<Date>::const_iterator it0 =
-                        std::upper_bound(nodes.begin(), nodes.end(), start);
-                    std::vector<Date>::const_iterator it1 =
-                        std::lower_bound(nodes.begin(), nodes.end(), end);
-                    localNodes.insert(localNodes.end(), it0, it1);
+                // premium coupons
+                if (!i->hasOccurred(effectiveProtectionStart, includeSettlementDateFlows)) {
+                    premiumNpv +=
+                        coupon->amount() *
+                        grid.discount(grid.index(coupon->date())) *
+                        grid.survival(grid.index(coupon->date()-1));
                 }
-                localNodes.push_back(end);
-
-                Real defaultAccrThisNode = 0.;
-                std::vector<Date>::const_iterator node = localNodes.begin();
-                Real t0 = discountCurve_->timeFromReference(*node);
-                Real P0 = discountCurve_->discount(*node);
-                Real Q0 = probability_->survivalProbability(*node);
-
-                for (++node; node != localNodes.end(); ++node) {
-                    Real t1 = discountCurve_->timeFromReference(*node);
-                    Real P1 = discountCurve_->discount(*node);
-                    Real Q1 = probability_->survivalProbability(*node);
-                    Real fhat = std::log(P0) - std::log(P1);
-                    Real hhat = std::log(Q0) - std::log(Q1);
-                    Real fhphh = fhat + hhat;
-                    if (fhphh < 1E-4 && numericalFix_ == Taylor) {
-                        // see above, terms up to (f+h)^3 seem more than enough,
-                        // what exactly is implemented in the standard isda C
-                        // code ?
-                        Real fhphhq = fhphh * fhphh;
-                        defaultAccrThisNode +=
-                            hhat * P0 * Q0 *
-                            ((t0 - tstart) *
-                                 (1.0 - 0.5 * fhphh + 1.0 / 6.0 * fhphhq -
-                                  1.0 / 24.0 * fhphhq * fhphh) +
-                             (t1 - t0) *
-                                 (0.5 - 1.0 / 3.0 * fhphh + 1.0 / 8.0 * fhphhq -
-                                  1.0 / 30.0 * fhphhq * fhphh));
-                    } else {
-                        defaultAccrThisNode +=
-                            (hhat / (fhphh + nFix)) *
-                            ((t1 - t0) * ((P0 * Q0 - P1 * Q1) / (fhphh + nFix) -
-                                          P1 * Q1) +
-                             (t0 - tstart) * (P0 * Q0 - P1 * Q1));
+
+                // default accruals
+
+                if (!detail::simple_event(coupon->accrualEndDate())
+                         .hasOccurred(effectiveProtectionStart, false)) {
+                    Date start = std::max<Date>(coupon->accrualStartDate(),
+                                                effectiveProtectionStart)-1;
+                    Date end = coupon->date()-1;
+                    Real tstart =
+                        discountCurve.timeFromReference(coupon->accrualStartDate()-1) -
+                        (accrualBias == IsdaCdsEngine::HalfDayBias ? 1.0 / 730.0 : 0.0);
+                    // the grid is sorted, so the local nodes are the grid
+                    // points from start to end (intermediary nodes only if
+                    // forwards are piecewise within the period)
+                    Size first = grid.index(start), last = grid.index(end);
+                    std::vector<Size> localNodes;
+                    localNodes.push_back(first);
+                    //add intermediary nodes, if any
+                    if (forwardsInCouponPeriod == IsdaCdsEngine::Piecewise) {
+                        std::vector<Date>::const_iterator it0 =
+                            std::upper_bound(nodes.begin(), nodes.end(), start);
+                        std::vector<Date>::const_iterator it1 =
+                            std::lower_bound(nodes.begin(), nodes.end(), end);
+                        for (; it0 < it1; ++it0)
+                            localNodes.push_back(grid.index(*it0));
                     }
+                    localNodes.push_back(last);
+
+                    Real defaultAccrThisNode = 0.;
+                    std::vector<Size>::const_iterator node = localNodes.begin();
+                    Size j0 = *node;
+                    Real t0 = grid.time(j0);
+                    Real P0 = grid.discount(j0);
+                    Real Q0 = grid.survival(j0);
+
+                    for (++node; node != localNodes.end(); ++node) {
+                        Size j1 = *node;
+                        Real t1 = grid.time(j1);
+                        Real P1 = grid.discount(j1);
+                        Real Q1 = grid.survival(j1);
+                        Real fhat = grid.logDiscount(j0) - grid.logDiscount(j1);
+                        Real hhat = grid.logSurvival(j0) - grid.logSurvival(j1);
+                        Real fhphh = fhat + hhat;
+                        if (fhphh < 1E-4 && numericalFix == IsdaCdsEngine::Taylor) {
+                            // see above, terms up to (f+h)^3 seem more than enough,
+                            // what exactly is implemented in the standard isda C
+                            // code ?
+                            Real fhphhq = fhphh * fhphh;
+                            defaultAccrThisNode +=
+                                hhat * P0 * Q0 *
+                                ((t0 - tstart) *
+                                     (1.0 - 0.5 * fhphh + 1.0 / 6.0 * fhphhq -
+                                      1.0 / 24.0 * fhphhq * fhphh) +
+                                 (t1 - t0) *
+                                     (0.5 - 1.0 / 3.0 * fhphh + 1.0 / 8.0 * fhphhq -
+                                      1.0 / 30.0 * fhphhq * fhphh));
+                        } else {
+                            defaultAccrThisNode +=
+                                (hhat / (fhphh + nFix)) *
+                                ((t1 - t0) * ((P0 * Q0 - P1 * Q1) / (fhphh + nFix) -
+                                              P1 * Q1) +
+                                 (t0 - tstart) * (P0 * Q0 - P1 * Q1));
+                        }
+
+                        j0 = j1;
+                        t0 = t1;
+                        P0 = P1;
+                        Q0 = Q1;
+                    }
+                    defaultAccrualNpv += defaultAccrThisNode * arguments.notional *
+                        coupon->rate() * 365. / 360.;
+                }
+            }
+
+
+            results.couponLegNPV = premiumNpv + defaultAccrualNpv;
 
-                    t0 = t1;
-                    P0 = P1;
-                    Q0 = Q1;
+            // upfront flow npv
+
+            Real upfPVO1 = 0.0;
+            results.upfrontNPV = 0.0;
+            if (!arguments.upfrontPayment->hasOccurred(
+                    evalDate, includeSettlementDateFlows)) {
+                upfPVO1 =
+                    discountCurve.discount(arguments.upfrontPayment->date());
+                if(arguments.upfrontPayment->amount() != 0.) {
+                    results.upfrontNPV = upfPVO1 * arguments.upfrontPayment->amount();
                 }
-                defaultAccrualNpv += defaultAccrThisNode * arguments_.notional *
-                    coupon->rate() * 365. / 360.;
-			}
-        }
+            }
 
+            results.accrualRebateNPV = 0.;
+            // NOLINTNEXTLINE(readability-implicit-bool-conversion)
+            if (arguments.accrualRebate && arguments.accrualRebate->amount() != 0. &&
+                !arguments.accrualRebate->hasOccurred(evalDate, includeSettlementDateFlows)) {
+                results.accrualRebateNPV =
+                    discountCurve.discount(arguments.accrualRebate->date()) *
+                    arguments.accrualRebate->amount();
+            }
+
+            Real upfrontSign = Protection::Seller != 0U ? 1.0 : -1.0;
+
+            if (arguments.side == Protection::Seller) {
+                results.defaultLegNPV *= -1.0;
+                results.accrualRebateNPV *= -1.0;
+            } else {
+                results.couponLegNPV *= -1.0;
+                results.upfrontNPV *= -1.0;
+            }
 
-        results_.couponLegNPV = premiumNpv + defaultAccrualNpv;
+            results.value = results.defaultLegNPV + results.couponLegNPV +
+                             results.upfrontNPV + results.accrualRebateNPV;
 
-        // upfront flow npv
+            results.errorEstimate = Null<Real>();
 
-        Real upfPVO1 = 0.0;
-        results_.upfrontNPV = 0.0;
-        if (!arguments_.upfrontPayment->hasOccurred(
-                evalDate, includeSettlementDateFlows_)) {
-            upfPVO1 =
-                discountCurve_->discount(arguments_.upfrontPayment->date());
-            if(arguments_.upfrontPayment->amount() != 0.) {
-                results_.upfrontNPV = upfPVO1 * arguments_.upfrontPayment->amount();
+            if (results.couponLegNPV != 0.0) {
+                results.fairSpread =
+                    -results.defaultLegNPV * arguments.spread /
+                    (results.couponLegNPV + results.accrualRebateNPV);
+            } else {
+                results.fairSpread = Null<Rate>();
             }
-        }
 
-        results_.accrualRebateNPV = 0.;
-        // NOLINTNEXTLINE(readability-implicit-bool-conversion)
-        if (arguments_.accrualRebate && arguments_.accrualRebate->amount() != 0. &&
-            !arguments_.accrualRebate->hasOccurred(evalDate, includeSettlementDateFlows_)) {
-            results_.accrualRebateNPV =
-                discountCurve_->discount(arguments_.accrualRebate->date()) *
-                arguments_.accrualRebate->amount();
-        }
+            Real upfrontSensitivity = upfPVO1 * arguments.notional;
+            if (upfrontSensitivity != 0.0) {
+                results.fairUpfront =
+                    -upfrontSign * (results.defaultLegNPV + results.couponLegNPV +
+                                    results.accrualRebateNPV) /
+                    upfrontSensitivity;
+            } else {
+                results.fairUpfront = Null<Rate>();
+            }
 
-        Real upfrontSign = Protection::Seller != 0U ? 1.0 : -1.0;
+            static const Rate basisPoint = 1.0e-4;
 
-        if (arguments_.side == Protection::Seller) {
-            results_.defaultLegNPV *= -1.0;
-            results_.accrualRebateNPV *= -1.0;
-        } else {
-            results_.couponLegNPV *= -1.0;
-            results_.upfrontNPV *= -1.0;
+            if (arguments.spread != 0.0) {
+                results.couponLegBPS =
+                    results.couponLegNPV * basisPoint / arguments.spread;
+            } else {
+                results.couponLegBPS = Null<Rate>();
+            }
+
+            // NOLINTNEXTLINE(readability-implicit-bool-conversion)
+            if (arguments.upfront && *arguments.upfront != 0.0) {
+                results.upfrontBPS =
+                    results.upfrontNPV * basisPoint / (*arguments.upfront);
+            } else {
+                results.upfrontBPS = Null<Rate>();
+            }
         }
 
-        results_.value = results_.defaultLegNPV + results_.couponLegNPV +
-                         results_.upfrontNPV + results_.accrualRebateNPV;
+    }
 
-        results_.errorEstimate = Null<Real>();
+    IsdaCdsEngine::IsdaCdsEngine(Handle<DefaultProbabilityTermStructure> probability,
+                                 Real recoveryRate,
+                                 Handle<YieldTermStructure> discountCurve,
+                                 const boost::optional<bool>& includeSettlementDateFlows,
+                                 const NumericalFix numericalFix,
+                                 const AccrualBias accrualBias,
+                                 const ForwardsInCouponPeriod forwardsInCouponPeriod)
+    : probability_(std::move(probability)), recoveryRate_(recoveryRate),
+      discountCurve_(std::move(discountCurve)),
+      includeSettlementDateFlows_(includeSettlementDateFlows), numericalFix_(numericalFix),
+      accrualBias_(accrualBias), forwardsInCouponPeriod_(forwardsInCouponPeriod) {
 
-        if (results_.couponLegNPV != 0.0) {
-            results_.fairSpread =
-                -results_.defaultLegNPV * arguments_.spread /
-                (results_.couponLegNPV + results_.accrualRebateNPV);
-        } else {
-            results_.fairSpread = Null<Rate>();
-        }
+        registerWith(probability_);
+        registerWith(discountCurve_);
+    }
 
-        Real upfrontSensitivity = upfPVO1 * arguments_.notional;
-        if (upfrontSensitivity != 0.0) {
-            results_.fairUpfront =
-                -upfrontSign * (results_.defaultLegNPV + results_.couponLegNPV +
-                                results_.accrualRebateNPV) /
-                upfrontSensitivity;
-        } else {
-            results_.fairUpfront = Null<Rate>();
-        }
+    void IsdaCdsEngine::calculate() const {
 
-        static const Rate basisPoint = 1.0e-4;
+        checkFlags(numericalFix_, accrualBias_, forwardsInCouponPeriod_);
 
-        if (arguments_.spread != 0.0) {
-            results_.couponLegBPS =
-                results_.couponLegNPV * basisPoint / arguments_.spread;
-        } else {
-            results_.couponLegBPS = Null<Rate>();
-        }
+        std::vector<Date> yDates = discountNodes(discountCurve_);
+        std::vector<Date> cDates = creditNodes(probability_);
+        IsdaDiscounts discounts(**discountCurve_);
+
+        isdaCalculate(arguments_, **probability_, cDates, recoveryRate_,
+                      **discountCurve_, yDates, discounts,
+                      includeSettlementDateFlows_, numericalFix_,
+                      accrualBias_, forwardsInCouponPeriod_, results_);
+    }
 
-        // NOLINTNEXTLINE(readability-implicit-bool-conversion)
-        if (arguments_.upfront && *arguments_.upfront != 0.0) {
-            results_.upfrontBPS =
-                results_.upfrontNPV * basisPoint / (*arguments_.upfront);
-        } else {
-            results_.upfrontBPS = Null<Rate>();
+    std::vector<CreditDefaultSwap::results> isdaCdsResults(
+        const std::vector<ext::shared_ptr<CreditDefaultSwap> >& swaps,
+        const std::vector<Handle<DefaultProbabilityTermStructure> >& probabilities,
+        const std::vector<Real>& recoveryRates,
+        const Handle<YieldTermStructure>& discountCurve,
+        const boost::optional<bool>& includeSettlementDateFlows,
+        IsdaCdsEngine::NumericalFix numericalFix,
+        IsdaCdsEngine::AccrualBias accrualBias,
+        IsdaCdsEngine::ForwardsInCouponPeriod forwardsInCouponPeriod) {
+
+        QL_REQUIRE(probabilities.size() == swaps.size(),
+                   "number of probability curves (" << probabilities.size()
+                   << ") does not match number of swaps ("
+                   << swaps.size() << ")");
+        QL_REQUIRE(recoveryRates.size() == swaps.size(),
+                   "number of recovery rates (" << recoveryRates.size()
+                   << ") does not match number of swaps ("
+                   << swaps.size() << ")");
+
+        checkFlags(numericalFix, accrualBias, forwardsInCouponPeriod);
+
+        std::vector<Date> yDates = discountNodes(discountCurve);
+        IsdaDiscounts discounts(**discountCurve);
+
+        std::vector<CreditDefaultSwap::results> results(swaps.size());
+        CreditDefaultSwap::arguments arguments;
+        for (Size i=0; i<swaps.size(); ++i) {
+            QL_REQUIRE(swaps[i], "null swap at position " << i);
+            swaps[i]->setupArguments(&arguments);
+            arguments.validate();
+            std::vector<Date> cDates = creditNodes(probabilities[i]);
+            results[i].reset();
+            isdaCalculate(arguments, **probabilities[i], cDates,
+                          recoveryRates[i], **discountCurve, yDates,
+                          discounts, includeSettlementDateFlows,
+                          numericalFix, accrualBias, forwardsInCouponPeriod,
+                          results[i]);
         }
+        return results;
     }
 }
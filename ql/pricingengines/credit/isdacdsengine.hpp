@@ -116,6 +116,32 @@ namespace QuantLib {
         const AccrualBias accrualBias_;
         const ForwardsInCouponPeriod forwardsInCouponPeriod_;
     };
+
+    //! ISDA engine results for a set of credit default swaps
+    /*! The i-th swap is priced on the i-th credit curve and recovery
+        rate, while the discount curve and the engine settings are shared.
+        The results are the same as those obtained by pricing each swap
+        with its own IsdaCdsEngine; however, the discount curve is checked
+        once and queried once per date for the whole set, which pays off
+        when many reference names share the standard coupon dates.
+
+        The swaps are not modified; in particular, their pricing engines
+        are neither used nor changed.
+
+        \warning The names are priced sequentially, since the credit
+                  curves (e.g. bootstrapped ones) may be lazily
+                  calculated and are not safe to share across threads.
+    */
+    std::vector<CreditDefaultSwap::results> isdaCdsResults(
+        const std::vector<ext::shared_ptr<CreditDefaultSwap> >& swaps,
+        const std::vector<Handle<DefaultProbabilityTermStructure> >& probabilities,
+        const std::vector<Real>& recoveryRates,
+        const Handle<YieldTermStructure>& discountCurve,
+        const boost::optional<bool>& includeSettlementDateFlows = boost::none,
+        IsdaCdsEngine::NumericalFix numericalFix = IsdaCdsEngine::Taylor,
+        IsdaCdsEngine::AccrualBias accrualBias = IsdaCdsEngine::HalfDayBias,
+        IsdaCdsEngine::ForwardsInCouponPeriod forwardsInCouponPeriod =
+            IsdaCdsEngine::Piecewise);
 }
 
 #endif
@@ -83,14 +83,14 @@ namespace QuantLib {
             const TimeGrid& timeGrid)
     : GenericModelEngine<ShortRateModel, Arguments, Results>(model),
       timeGrid_(timeGrid), timeSteps_(0) {
-        lattice_ = this->model_->tree(timeGrid);
+        lattice_ = this->model_->cachedTree(timeGrid);
     }
 
     template <class Arguments, class Results>
     void LatticeShortRateModelEngine<Arguments, Results>::update()
     {
         if (!timeGrid_.empty())
-            lattice_ = this->model_->tree(timeGrid_);
+            lattice_ = this->model_->cachedTree(timeGrid_);
         GenericModelEngine<ShortRateModel, Arguments, Results>::update();
     }
 
@@ -65,7 +65,7 @@ namespace QuantLib {
             lattice = lattice_;
         } else {
             TimeGrid timeGrid(times.begin(), times.end(), timeSteps_);
-            lattice = model_->tree(timeGrid);
+            lattice = model_->cachedTree(timeGrid);
         }
 
         Time maxTime = *std::max_element(times.begin(), times.end());
@@ -220,6 +220,14 @@ namespace QuantLib {
             event0Time = std::max(
                 model_->termStructure()->timeFromReference(event0), 0.0);
 
+            // the numeraire on the whole grid (or at the conditioning state
+            // if we are at the expiry), memoized by the model
+            Array numeraire0;
+            if (isEventDate)
+                numeraire0 = model_->numeraire(
+                    event0Time, event0 > expiry ? z : Array(1, y),
+                    discountCurve_);
+
             // todo add openmp support later on (as in gaussian1dswaptionengine)
 
             for (Size k = 0; k < (event0 > expiry ? npv0.size() : 1); k++) {
@@ -503,8 +511,7 @@ namespace QuantLib {
                                 amount *
                                 model_->zerobond(arguments_.leg1PayDates[j],
                                                  event0, zk, discountCurve_) /
-                                model_->numeraire(event0Time, zk,
-                                                  discountCurve_) *
+                                numeraire0[k] *
                                 zSpreadDf;
 
                             if (j < arguments_.leg1FixingDates.size() - 1) {
@@ -581,8 +588,7 @@ namespace QuantLib {
                                 amount *
                                 model_->zerobond(arguments_.leg2PayDates[j],
                                                  event0, zk, discountCurve_) /
-                                model_->numeraire(event0Time, zk,
-                                                  discountCurve_) *
+                                numeraire0[k] *
                                 zSpreadDf;
                             if (j < arguments_.leg2FixingDates.size() - 1) {
                                 j++;
@@ -617,8 +623,7 @@ namespace QuantLib {
                         Real exerciseValue =
                             (type == Option::Call ? 1.0 : -1.0) * npv0a[k] +
                             rebate * model_->zerobond(rebateDate, event0) *
-                                zSpreadDf / model_->numeraire(event0Time, zk,
-                                                              discountCurve_);
+                                zSpreadDf / numeraire0[k];
 
                         if (considerProbabilities && probabilities_ != None) {
                             if (exIdx == noEx) {
@@ -200,6 +200,87 @@ namespace QuantLib {
                                  arguments_.floatingResetDates.end(), expiry0 - 1) -
                 arguments_.floatingResetDates.begin();
 
+            // the exercise values are computed on the whole grid at once,
+            // the model memoizes the zerobond and numeraire arrays on the
+            // grid
+            Array exerciseValue(z.size(), 0.0);
+            if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0);
+                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(-oas_->value() *
+                                       (model_->termStructure()
+                                            ->dayCounter()
+                                            .yearFraction(
+                                                expiry0,
+                                                arguments_.floatingPayDates[l])));
+                    Array forward;
+                    if (!arguments_.floatingIsRedemptionFlow[l])
+                        forward = model_->forwardRate(
+                            arguments_.floatingFixingDates[l], expiry0, z,
+                            arguments_.swap->iborIndex());
+                    Array discount = model_->zerobond(
+                        arguments_.floatingPayDates[l], expiry0, z,
+                        discountCurve_);
+                    for (Size k = 0; k < z.size(); k++) {
+                        Real amount;
+                        if (arguments_.floatingIsRedemptionFlow[l])
+                            amount = arguments_.floatingCoupons[l];
+                        else
+                            amount = arguments_.floatingNominal[l] *
+                                     arguments_.floatingAccrualTimes[l] *
+                                     (arguments_.floatingGearings[l] *
+                                          forward[k] +
+                                      arguments_.floatingSpreads[l]);
+                        floatingLegNpv[k] += amount * discount[k] * zSpreadDf;
+                    }
+                }
+                Array fixedLegNpv(z.size(), 0.0);
+                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(-oas_->value() *
+                                       (model_->termStructure()
+                                            ->dayCounter()
+                                            .yearFraction(
+                                                expiry0,
+                                                arguments_.fixedPayDates[l])));
+                    Array discount = model_->zerobond(
+                        arguments_.fixedPayDates[l], expiry0, z,
+                        discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] +=
+                            arguments_.fixedCoupons[l] * discount[k] * zSpreadDf;
+                }
+                Real rebate = 0.0;
+                Real zSpreadDf = 1.0;
+                Date rebateDate = expiry0;
+                if (rebatedExercise != nullptr) {
+                    rebate = rebatedExercise->rebate(idx);
+                    rebateDate = rebatedExercise->rebatePaymentDate(idx);
+                    zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(-oas_->value() *
+                                       (model_->termStructure()
+                                            ->dayCounter()
+                                            .yearFraction(expiry0, rebateDate)));
+                }
+                Array rebateDiscount =
+                    model_->zerobond(rebateDate, expiry0, z, discountCurve_);
+                Array numeraire =
+                    model_->numeraire(expiry0Time, z, discountCurve_);
+                for (Size k = 0; k < z.size(); k++)
+                    exerciseValue[k] =
+                        ((type == Option::Call ? 1.0 : -1.0) *
+                             (floatingLegNpv[k] - fixedLegNpv[k]) +
+                         rebate * rebateDiscount[k] * zSpreadDf) /
+                        numeraire[k];
+            }
+
             // todo add openmp support later on (as in gaussian1dswaptionengine)
 
             for (Size k = 0; k < (expiry0 > settlement ? npv0.size() : 1);
@@ -362,78 +443,6 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_
-                                                    .floatingPayDates[l])));
-                        Real amount;
-                        if (arguments_.floatingIsRedemptionFlow[l])
-                            amount = arguments_.floatingCoupons[l];
-                        else
-                            amount = arguments_.floatingNominal[l] *
-                                     arguments_.floatingAccrualTimes[l] *
-                                     (arguments_.floatingGearings[l] *
-                                          model_->forwardRate(
-                                              arguments_.floatingFixingDates[l],
-                                              expiry0, z[k],
-                                              arguments_.swap->iborIndex()) +
-                                      arguments_.floatingSpreads[l]);
-                        floatingLegNpv +=
-                            amount *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_.fixedPayDates[l])));
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real rebate = 0.0;
-                    Real zSpreadDf = 1.0;
-                    Date rebateDate = expiry0;
-                    if (rebatedExercise != nullptr) {
-                        rebate = rebatedExercise->rebate(idx);
-                        rebateDate = rebatedExercise->rebatePaymentDate(idx);
-                        zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(expiry0, rebateDate)));
-                    }
-                    Real exerciseValue =
-                        ((type == Option::Call ? 1.0 : -1.0) *
-                             (floatingLegNpv - fixedLegNpv) +
-                         rebate * model_->zerobond(rebateDate, expiry0, z[k],
-                                                   discountCurve_) *
-                             zSpreadDf) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
 
                     // for probability computation
                     if (probabilities_ != None) {
@@ -450,7 +459,7 @@ namespace QuantLib {
                                                               discountCurve_) *
                                              model_->numeraire(expiry0, z[k],
                                                                discountCurve_));
-                        if (exerciseValue >= npv0[k]) {
+                        if (exerciseValue[k] >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
                                     ? 1.0
@@ -467,7 +476,7 @@ namespace QuantLib {
                     }
                     // end probability computation
 
-                    npv0[k] = std::max(npv0[k], exerciseValue);
+                    npv0[k] = std::max(npv0[k], exerciseValue[k]);
                 }
             }
 
@@ -99,21 +99,45 @@ namespace QuantLib {
             if (expiry1Time != Null<Real>())
                 model_->yGrid(stddevs_, integrationPoints_, expiry1Time,
                               expiry0Time, 0.0);
+#endif
+
+            // the exercise values are computed on the whole grid at once
+            // (outside the parallelized loop, this also triggers the
+            // computations mentioned above), the model memoizes the
+            // zerobond and numeraire arrays on the grid
+            Array exerciseValue(z.size(), 0.0);
             if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0);
                 for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
-                    model_->forwardRate(arguments_.floatingFixingDates[l],
-                                        expiry0, 0.0,
-                                        arguments_.swap->iborIndex());
-                    model_->zerobond(arguments_.floatingPayDates[l], expiry0,
-                                     0.0, discountCurve_);
+                    Array forward = model_->forwardRate(
+                        arguments_.floatingFixingDates[l], expiry0, z,
+                        arguments_.swap->iborIndex());
+                    Array discount = model_->zerobond(
+                        arguments_.floatingPayDates[l], expiry0, z,
+                        discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        floatingLegNpv[k] +=
+                            arguments_.nominal *
+                            arguments_.floatingAccrualTimes[l] *
+                            (arguments_.floatingSpreads[l] + forward[k]) *
+                            discount[k];
                 }
+                Array fixedLegNpv(z.size(), 0.0);
                 for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                    model_->zerobond(arguments_.fixedPayDates[l], expiry0, 0.0,
-                                     discountCurve_);
+                    Array discount = model_->zerobond(
+                        arguments_.fixedPayDates[l], expiry0, z,
+                        discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] +=
+                            arguments_.fixedCoupons[l] * discount[k];
                 }
-                model_->numeraire(expiry0Time, 0.0, discountCurve_);
+                Array numeraire =
+                    model_->numeraire(expiry0Time, z, discountCurve_);
+                for (Size k = 0; k < z.size(); k++)
+                    exerciseValue[k] = (type == Option::Call ? 1.0 : -1.0) *
+                                       (floatingLegNpv[k] - fixedLegNpv[k]) /
+                                       numeraire[k];
             }
-#endif
 
 #pragma omp parallel for default(shared) firstprivate(p) if(expiry0>settlement)
             for (long k = 0; k < (expiry0 > settlement ? (long)npv0.size() : 1);
@@ -254,30 +278,6 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        floatingLegNpv +=
-                            arguments_.nominal *
-                            arguments_.floatingAccrualTimes[l] *
-                            (arguments_.floatingSpreads[l] +
-                             model_->forwardRate(
-                                 arguments_.floatingFixingDates[l], expiry0,
-                                 z[k], arguments_.swap->iborIndex())) *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real exerciseValue =
-                        (type == Option::Call ? 1.0 : -1.0) *
-                        (floatingLegNpv - fixedLegNpv) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
 
                     // for probability computation
                     if (probabilities_ != None) {
@@ -294,7 +294,7 @@ namespace QuantLib {
                                                               discountCurve_) *
                                              model_->numeraire(expiry0, z[k],
                                                                discountCurve_));
-                        if (exerciseValue >= npv0[k]) {
+                        if (exerciseValue[k] >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
                                     ? 1.0
@@ -311,7 +311,7 @@ namespace QuantLib {
                     }
                     // end probability computation
 
-                    npv0[k] = std::max(npv0[k], exerciseValue);
+                    npv0[k] = std::max(npv0[k], exerciseValue[k]);
                 }
             }
 
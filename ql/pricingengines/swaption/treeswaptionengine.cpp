@@ -77,7 +77,7 @@ namespace QuantLib {
         } else {
             std::vector<Time> times = swaption.mandatoryTimes();
             TimeGrid timeGrid(times.begin(), times.end(), timeSteps_);
-            lattice = model_->tree(timeGrid);
+            lattice = model_->cachedTree(timeGrid);
         }
 
         std::vector<Time> stoppingTimes(arguments_.exercise->dates().size());
@@ -97,4 +97,20 @@ namespace QuantLib {
         results_.value = swaption.presentValue();
     }
 
+    TimeGrid TreeSwaptionEngine::unionTimeGrid(
+                    const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+                    const Date& referenceDate,
+                    const DayCounter& dayCounter,
+                    Size timeSteps) {
+        std::vector<Time> times;
+        for (const auto& s : swaptions) {
+            Swaption::arguments arguments;
+            s->setupArguments(&arguments);
+            DiscretizedSwaption swaption(arguments, referenceDate, dayCounter);
+            std::vector<Time> t = swaption.mandatoryTimes();
+            times.insert(times.end(), t.begin(), t.end());
+        }
+        return TimeGrid(times.begin(), times.end(), timeSteps);
+    }
+
 }
@@ -62,6 +62,18 @@ namespace QuantLib {
         //@}
         void calculate() const override;
 
+        //! time grid including the mandatory times of all the swaptions
+        /*! An engine built on this grid prices all of the given
+            swaptions on the same tree, which is fitted only once.
+            The reference date and day counter must be those of the
+            term structure used by the engine.
+        */
+        static TimeGrid unionTimeGrid(
+            const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+            const Date& referenceDate,
+            const DayCounter& dayCounter,
+            Size timeSteps);
+
       private:
         Handle<YieldTermStructure> termStructure_;
     };
@@ -408,6 +408,12 @@ namespace QuantLib {
     }
 
     Real AnalyticHestonEngine::AP_Helper::operator()(Real u) const {
+        return (std::exp(std::complex<Real>(0.0, u*freq_))
+            * chFDifference(u) / (u*u + 0.25)).real();
+    }
+
+    std::complex<Real>
+    AnalyticHestonEngine::AP_Helper::chFDifference(Real u) const {
         QL_REQUIRE(   enginePtr_->addOnTerm(u, term_, 1)
                         == std::complex<Real>(0.0)
                    && enginePtr_->addOnTerm(u, term_, 2)
@@ -431,8 +437,7 @@ namespace QuantLib {
             QL_FAIL("unknown control variate");
         }
 
-        return (std::exp(std::complex<Real>(0.0, u*freq_))
-            * (phiBS - enginePtr_->chF(z, term_)) / (u*u + 0.25)).real();
+        return phiBS - enginePtr_->chF(z, term_);
     }
 
     Real AnalyticHestonEngine::AP_Helper::controlVariateValue() const {
@@ -454,6 +459,32 @@ namespace QuantLib {
             QL_FAIL("unknown control variate");
     }
 
+    // replays the cached strike independent part of the integrand
+    class AnalyticHestonEngine::Slice_Helper {
+      public:
+        Slice_Helper(const AP_Helper& helper,
+                     Real freq,
+                     ext::shared_ptr<ChFSlice> slice)
+        : helper_(helper), freq_(freq), slice_(std::move(slice)), idx_(0) {}
+
+        Real operator()(Real u) const {
+            // the nodes are visited in the same order as during the
+            // set-up of the slice, fall back to a full evaluation if not
+            const std::complex<Real> d =
+                (idx_ < slice_->u.size() && slice_->u[idx_] == u)
+                ? slice_->values[idx_++] : helper_.chFDifference(u);
+
+            return (std::exp(std::complex<Real>(0.0, u*freq_))
+                * d / (u*u + 0.25)).real();
+        }
+
+      private:
+        const AP_Helper& helper_;
+        const Real freq_;
+        const ext::shared_ptr<ChFSlice> slice_;
+        mutable Size idx_;
+    };
+
     std::complex<Real> AnalyticHestonEngine::chF(
         const std::complex<Real>& z, Time t) const {
 
@@ -521,7 +552,7 @@ namespace QuantLib {
       cpxLog_     (Gatheral),
       integration_(new Integration(
                           Integration::gaussLaguerre(integrationOrder))),
-      andersenPiterbargEpsilon_(Null<Real>()) {
+      andersenPiterbargEpsilon_(Null<Real>()), maxCachedMaturities_(0) {
     }
 
     AnalyticHestonEngine::AnalyticHestonEngine(
@@ -534,7 +565,7 @@ namespace QuantLib {
       cpxLog_(Gatheral),
       integration_(new Integration(Integration::gaussLobatto(
                               relTolerance, Null<Real>(), maxEvaluations))),
-      andersenPiterbargEpsilon_(Null<Real>()) {
+      andersenPiterbargEpsilon_(Null<Real>()), maxCachedMaturities_(0) {
     }
 
     AnalyticHestonEngine::AnalyticHestonEngine(
@@ -548,7 +579,8 @@ namespace QuantLib {
       evaluations_(0),
       cpxLog_(cpxLog),
       integration_(new Integration(integration)),
-      andersenPiterbargEpsilon_(andersenPiterbargEpsilon) {
+      andersenPiterbargEpsilon_(andersenPiterbargEpsilon),
+      maxCachedMaturities_(0) {
         QL_REQUIRE(   cpxLog_ != BranchCorrection
                    || !integration.isAdaptiveIntegration(),
                    "Branch correction does not work in conjunction "
@@ -572,6 +604,101 @@ namespace QuantLib {
         return evaluations_;
     }
 
+    void AnalyticHestonEngine::enableSliceCaching(Size maxMaturities) {
+        QL_REQUIRE(isSliceCacheable(cpxLog_, *integration_),
+                   "slice caching requires a control variate formula "
+                   "and a Gaussian quadrature");
+        QL_REQUIRE(maxMaturities > 0, "positive number of maturities required");
+
+        maxCachedMaturities_ = maxMaturities;
+        cachedParams_ = Array();
+        chFSlices_.clear();
+        cachedTerms_.clear();
+    }
+
+    bool AnalyticHestonEngine::isSliceCacheable(
+        ComplexLogFormula cpxLog, const Integration& integration) const {
+        return (   cpxLog == AndersenPiterbarg
+                || cpxLog == AndersenPiterbargOptCV
+                || cpxLog == AsymptoticChF
+                || cpxLog == OptimalCV)
+            && integration.isGaussianQuadrature();
+    }
+
+    ext::shared_ptr<AnalyticHestonEngine::ChFSlice>
+    AnalyticHestonEngine::calculateChFSlice(Time term) const {
+        const Real v0    = model_->v0();
+        const Real kappa = model_->kappa();
+        const Real theta = model_->theta();
+        const Real sigma = model_->sigma();
+        const Real rho   = model_->rho();
+
+        const Real c_inf =
+            std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*term)/sigma;
+
+        // forward and strike do not enter the strike independent part
+        const AP_Helper helper(term, 1.0, 1.0,
+            (cpxLog_ == OptimalCV)
+                ? optimalControlVariate(term, v0, kappa, theta, sigma, rho)
+                : cpxLog_,
+            this);
+
+        const ext::shared_ptr<ChFSlice> slice = ext::make_shared<ChFSlice>();
+        integration_->calculate(c_inf, [&](Real u) -> Real {
+            slice->u.push_back(u);
+            slice->values.push_back(helper.chFDifference(u));
+            return 0.0;
+        });
+
+        return slice;
+    }
+
+    ext::shared_ptr<AnalyticHestonEngine::ChFSlice>
+    AnalyticHestonEngine::chFSlice(Time term) const {
+        const Array params = model_->params();
+
+        if (params.size() != cachedParams_.size()
+            || !std::equal(params.begin(), params.end(),
+                           cachedParams_.begin())) {
+            // new model parameters, e.g. during a calibration. Refill
+            // the cache for all maturities seen so far.
+            cachedParams_ = params;
+            chFSlices_.clear();
+
+            const std::vector<Time> terms(
+                cachedTerms_.begin(), cachedTerms_.end());
+            std::vector<ext::shared_ptr<ChFSlice> > slices(terms.size());
+            std::string error;
+
+            #pragma omp parallel for
+            for (long i=0; i < (long)terms.size(); ++i) {
+                try {
+                    slices[i] = calculateChFSlice(terms[i]);
+                }
+                catch (std::exception& e) {
+                    #pragma omp critical
+                    error = e.what();
+                }
+            }
+            QL_REQUIRE(error.empty(), error);
+
+            for (Size i=0; i < terms.size(); ++i)
+                chFSlices_[terms[i]] = slices[i];
+        }
+
+        const auto iter = chFSlices_.find(term);
+        if (iter != chFSlices_.end())
+            return iter->second;
+
+        if (cachedTerms_.size() >= maxCachedMaturities_) {
+            chFSlices_.erase(cachedTerms_.front());
+            cachedTerms_.pop_front();
+        }
+        cachedTerms_.push_back(term);
+
+        return chFSlices_[term] = calculateChFSlice(term);
+    }
+
     void AnalyticHestonEngine::doCalculation(Real riskFreeDiscount,
                                              Real dividendDiscount,
                                              Real spotPrice,
@@ -645,7 +772,15 @@ namespace QuantLib {
 
             const Real cvValue = cvHelper.controlVariateValue();
 
-            const Real h_cv = integration.calculate(c_inf, cvHelper, uM)
+            const bool useSliceCache = enginePtr->maxCachedMaturities_ > 0
+                && cpxLog == enginePtr->cpxLog_
+                && &integration == enginePtr->integration_.get();
+
+            const Real h_cv = ((useSliceCache)
+                ? integration.calculate(c_inf,
+                      Slice_Helper(cvHelper, std::log(fwdPrice/strikePrice),
+                                   enginePtr->chFSlice(term)), uM)
+                : integration.calculate(c_inf, cvHelper, uM))
                 * std::sqrt(strikePrice * fwdPrice)/M_PI;
             evaluations += integration.numberOfEvaluations();
 
@@ -711,6 +846,37 @@ namespace QuantLib {
     }
 
 
+    std::vector<Real> AnalyticHestonEngine::priceChain(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        const Date& maturityDate, Real L, Size N) const {
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+
+        const Real riskFreeDiscount =
+            process->riskFreeRate()->discount(maturityDate);
+        const Real dividendDiscount =
+            process->dividendYield()->discount(maturityDate);
+
+        const Real spotPrice = process->s0()->value();
+        QL_REQUIRE(spotPrice > 0.0, "negative or null underlying given");
+
+        const Real term = process->time(maturityDate);
+
+        // j = 2 selects the add-on term under the risk neutral measure
+        const ext::function<std::complex<Real>(Real)> phi =
+            [&](Real u) -> std::complex<Real> {
+                return chF(std::complex<Real>(u, 0.0), term)
+                    * std::exp(addOnTerm(u, term, 2));
+            };
+
+        Real c1, c2;
+        COSChainPricer::cumulants(phi, c1, c2);
+
+        return COSChainPricer(phi, c1, c2, L, N).values(
+            payoffs, spotPrice*dividendDiscount/riskFreeDiscount,
+            riskFreeDiscount);
+    }
+
     AnalyticHestonEngine::Integration::Integration(Algorithm intAlgo,
                                                    ext::shared_ptr<Integrator> integrator)
     : intAlgo_(intAlgo), integrator_(std::move(integrator)) {}
@@ -811,6 +977,10 @@ namespace QuantLib {
         }
     }
 
+    bool AnalyticHestonEngine::Integration::isGaussianQuadrature() const {
+        return gaussianQuadrature_ != nullptr;
+    }
+
     bool AnalyticHestonEngine::Integration::isAdaptiveIntegration() const {
         return intAlgo_ == GaussLobatto
             || intAlgo_ == GaussKronrod
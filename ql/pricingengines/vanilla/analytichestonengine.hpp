@@ -29,10 +29,13 @@
 #include <ql/math/integrals/integral.hpp>
 #include <ql/math/integrals/gaussianquadratures.hpp>
 #include <ql/pricingengines/genericmodelengine.hpp>
+#include <ql/pricingengines/vanilla/coschainpricer.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/functional.hpp>
 #include <complex>
+#include <deque>
+#include <map>
 
 namespace QuantLib {
 
@@ -132,6 +135,31 @@ namespace QuantLib {
         void calculate() const override;
         Size numberOfEvaluations() const;
 
+        /*! Caches the characteristic function on the integration nodes
+            for up to maxMaturities maturities. All options with the
+            same maturity share these values and only the strike
+            dependent factor of the integrand is evaluated per option,
+            which speeds up calibrations to full volatility surfaces.
+            Whenever the model parameters change, the cache is refilled
+            for all maturities seen so far, in parallel if OpenMP is
+            enabled.
+
+            \note The cache requires one of the control variate
+                  formulas and a Gaussian quadrature.
+        */
+        void enableSliceCaching(Size maxMaturities = 64);
+
+        //! values of all options with the given payoffs and maturity
+        /*! The options are priced with the COS method rather than
+            with the Fourier integration of calculate(). The
+            characteristic function, including the add-on term of
+            derived engines like BatesEngine, is evaluated once and
+            shared by all strikes, see COSChainPricer.
+        */
+        std::vector<Real> priceChain(
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+            const Date& maturityDate, Real L = 16, Size N = 200) const;
+
         static void doCalculation(Real riskFreeDiscount,
                                   Real dividendDiscount,
                                   Real spotPrice,
@@ -163,6 +191,9 @@ namespace QuantLib {
             Real operator()(Real u) const;
             Real controlVariateValue() const;
 
+            //! strike independent part of the integrand
+            std::complex<Real> chFDifference(Real u) const;
+
           private:
             const Time term_;
             const Real fwd_, strike_, freq_;
@@ -181,11 +212,26 @@ namespace QuantLib {
 
       private:
         class Fj_Helper;
+        class Slice_Helper;
+
+        struct ChFSlice {
+            std::vector<Real> u;
+            std::vector<std::complex<Real> > values;
+        };
+        bool isSliceCacheable(ComplexLogFormula cpxLog,
+                              const Integration& integration) const;
+        ext::shared_ptr<ChFSlice> chFSlice(Time term) const;
+        ext::shared_ptr<ChFSlice> calculateChFSlice(Time term) const;
 
         mutable Size evaluations_;
         const ComplexLogFormula cpxLog_;
         const ext::shared_ptr<Integration> integration_;
         const Real andersenPiterbargEpsilon_;
+
+        Size maxCachedMaturities_;
+        mutable Array cachedParams_;
+        mutable std::map<Time, ext::shared_ptr<ChFSlice> > chFSlices_;
+        mutable std::deque<Time> cachedTerms_;
     };
 
 
@@ -227,6 +273,7 @@ namespace QuantLib {
 
         Size numberOfEvaluations() const;
         bool isAdaptiveIntegration() const;
+        bool isGaussianQuadrature() const;
 
       private:
         enum Algorithm
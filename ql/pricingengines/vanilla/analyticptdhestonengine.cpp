@@ -208,6 +208,41 @@ namespace QuantLib {
         return std::exp(lnChF(z, T));
     }
 
+    std::vector<Real> AnalyticPTDHestonEngine::priceChain(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        const Date& maturityDate, Real L, Size N) const {
+
+        const Real spotPrice = model_->s0();
+        QL_REQUIRE(spotPrice > 0.0, "negative or null underlying given");
+
+        const Real term
+            = model_->riskFreeRate()->dayCounter().yearFraction(
+                                     model_->riskFreeRate()->referenceDate(),
+                                     maturityDate);
+
+        QL_REQUIRE(term < model_->timeGrid().back() ||
+                       close_enough(term, model_->timeGrid().back()),
+                   "maturity (" << term << ") is too large, time grid is bounded by "
+                                << model_->timeGrid().back());
+
+        const Real riskFreeDiscount =
+            model_->riskFreeRate()->discount(maturityDate);
+        const Real dividendDiscount =
+            model_->dividendYield()->discount(maturityDate);
+
+        const ext::function<std::complex<Real>(Real)> phi =
+            [&](Real u) -> std::complex<Real> {
+                return chF(std::complex<Real>(u, 0.0), term);
+            };
+
+        Real c1, c2;
+        COSChainPricer::cumulants(phi, c1, c2);
+
+        return COSChainPricer(phi, c1, c2, L, N).values(
+            payoffs, spotPrice*dividendDiscount/riskFreeDiscount,
+            riskFreeDiscount);
+    }
+
     AnalyticPTDHestonEngine::AnalyticPTDHestonEngine(
         const ext::shared_ptr<PiecewiseTimeDependentHestonModel>& model,
         Size integrationOrder)
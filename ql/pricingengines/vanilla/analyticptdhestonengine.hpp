@@ -87,6 +87,16 @@ namespace QuantLib {
         std::complex<Real> chF(const std::complex<Real>& z, Time t) const;
         std::complex<Real> lnChF(const std::complex<Real>& z, Time t) const;
 
+        //! values of all options with the given payoffs and maturity
+        /*! The options are priced with the COS method rather than
+            with the Fourier integration of calculate(). The
+            characteristic function is evaluated once and shared by
+            all strikes, see COSChainPricer.
+        */
+        std::vector<Real> priceChain(
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+            const Date& maturityDate, Real L = 16, Size N = 200) const;
+
       private:
         class Fj_Helper;
         class AP_Helper;
@@ -0,0 +1,103 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/pricingengines/vanilla/coschainpricer.hpp>
+#include <cmath>
+
+namespace QuantLib {
+
+    COSChainPricer::COSChainPricer(
+        const ext::function<std::complex<Real>(Real)>& chF,
+        Real c1, Real c2, Real L, Size N)
+    : r_(N), v_(N) {
+        QL_REQUIRE(N > 1, "at least two expansion terms required");
+        QL_REQUIRE(L > 0.0, "positive truncation range required");
+
+        const Real w = std::sqrt(std::fabs(c2));
+
+        // lower bound of the range for an at-the-money-forward strike;
+        // the bound for strike K is a0_ + ln(F/K)
+        a0_ = c1 - L*w;
+        d_ = 1.0/(2.0*L*w);
+        phi0_ = chF(0.0).real();
+
+        // strike independent part of the expansion
+        for (Size n=1; n < N; ++n) {
+            const Real r = n*M_PI*d_;
+            r_[n] = r;
+            v_[n] = (chF(r)*std::exp(std::complex<Real>(0.0, -r*a0_))).real();
+        }
+    }
+
+    Real COSChainPricer::value(const PlainVanillaPayoff& payoff,
+                               Real forward,
+                               DiscountFactor riskFreeDiscount) const {
+        const Real k = payoff.strike();
+        QL_REQUIRE(forward > 0.0, "negative or null forward given");
+        QL_REQUIRE(k > 0.0, "negative or null strike given");
+
+        const Real a = std::log(forward/k) + a0_;
+        const Real expA = std::exp(a);
+
+        // undiscounted put value in units of the strike
+        Real s = phi0_*(expA-1-a)*d_;
+        for (Size n=1; n < r_.size(); ++n) {
+            const Real r = r_[n];
+            const Real sinRA = std::sin(r*a);
+            const Real U_n = 2.0*d_*( 1.0/(1.0 + r*r)
+                *(expA + r*sinRA - std::cos(r*a)) - 1.0/r*sinRA);
+
+            s += U_n*v_[n];
+        }
+
+        switch (payoff.optionType()) {
+          case Option::Put:
+            return k*riskFreeDiscount*s;
+          case Option::Call:
+            return riskFreeDiscount*(forward - k*(1-s));
+          default:
+            QL_FAIL("unknown payoff type");
+        }
+    }
+
+    std::vector<Real> COSChainPricer::values(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        Real forward, DiscountFactor riskFreeDiscount) const {
+
+        std::vector<Real> result(payoffs.size());
+        for (Size i=0; i < payoffs.size(); ++i) {
+            QL_REQUIRE(payoffs[i], "null payoff given");
+            result[i] = value(*payoffs[i], forward, riskFreeDiscount);
+        }
+        return result;
+    }
+
+    void COSChainPricer::cumulants(
+        const ext::function<std::complex<Real>(Real)>& chF,
+        Real& c1, Real& c2) {
+        const Real h = 1e-3;
+        const std::complex<Real> lp = std::log(chF(h));
+        const std::complex<Real> lm = std::log(chF(-h));
+        const std::complex<Real> l0 = std::log(chF(0.0));
+
+        c1 = (lp - lm).imag()/(2*h);
+        c2 = -(lp - 2.0*l0 + lm).real()/(h*h);
+    }
+
+}
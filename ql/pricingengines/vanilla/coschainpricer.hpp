@@ -0,0 +1,76 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2026 Godolphin Capital Management
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file coschainpricer.hpp
+    \brief COS-method pricing of European option chains
+*/
+
+#ifndef quantlib_cos_chain_pricer_hpp
+#define quantlib_cos_chain_pricer_hpp
+
+#include <ql/functional.hpp>
+#include <ql/instruments/payoffs.hpp>
+#include <complex>
+#include <vector>
+
+namespace QuantLib {
+
+    //! COS-method pricer for all European options of one maturity
+
+    /*! The normalized characteristic function of \f$ \ln(S_T/F) \f$
+        is sampled once on the cosine grid of the truncation range
+        \f$ [c_1 - L\sqrt{c_2}, c_1 + L\sqrt{c_2}] \f$. Shifting the
+        range by the log-moneyness of a strike leaves the grid
+        unchanged, therefore all strikes share these samples and only
+        the strike dependent payoff coefficients are evaluated per
+        option.
+
+        References:
+
+        F. Fang, C.W. Oosterlee: A Novel Pricing Method for European
+        Options based on Fourier-Cosine Series Expansions,
+        http://ta.twi.tudelft.nl/mf/users/oosterle/oosterlee/COS.pdf
+    */
+    class COSChainPricer {
+      public:
+        COSChainPricer(const ext::function<std::complex<Real>(Real)>& chF,
+                       Real c1, Real c2, Real L = 16, Size N = 200);
+
+        //! value of a single option
+        Real value(const PlainVanillaPayoff& payoff,
+                   Real forward, DiscountFactor riskFreeDiscount) const;
+
+        //! values of all options
+        std::vector<Real> values(
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+            Real forward, DiscountFactor riskFreeDiscount) const;
+
+        //! first two cumulants from finite differences of the log of chF
+        static void cumulants(
+            const ext::function<std::complex<Real>(Real)>& chF,
+            Real& c1, Real& c2);
+
+      private:
+        Real a0_, d_, phi0_;
+        std::vector<Real> r_, v_;
+    };
+
+}
+
+#endif
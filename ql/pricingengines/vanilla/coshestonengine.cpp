@@ -59,18 +59,18 @@ namespace QuantLib {
             ext::dynamic_pointer_cast<PlainVanillaPayoff>(arguments_.payoff);
         QL_REQUIRE(payoff, "non plain vanilla payoff given");
 
-        const ext::shared_ptr<HestonProcess> process = model_->process();
+        results_.value = priceChain(
+            std::vector<ext::shared_ptr<PlainVanillaPayoff> >(1, payoff),
+            arguments_.exercise->lastDate()).front();
+    }
 
-        const Date maturityDate = arguments_.exercise->lastDate();
-        const Time maturity = process->time(maturityDate);
+    std::vector<Real> COSHestonEngine::priceChain(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        const Date& maturityDate) const {
 
-        const Real cum1 = c1(maturity);
-        const Real w = std::sqrt(std::fabs(c2(maturity))
-            // the 4th order doesn't necessarily improve the precision
-            // + std::sqrt(std::fabs(c4(maturity)))
-        );
+        const ext::shared_ptr<HestonProcess> process = model_->process();
+        const Time maturity = process->time(maturityDate);
 
-        const Real k = payoff->strike();
         const Real spot = process->s0()->value();
         QL_REQUIRE(spot > 0.0, "negative or null underlying given");
 
@@ -79,34 +79,14 @@ namespace QuantLib {
         const DiscountFactor qf
             = process->dividendYield()->discount(maturityDate);
         const Real fwd = spot*qf/df;
-        const Real x = std::log(fwd/k);
-
-        const Real a = x + cum1 - L_*w;
-        const Real b = x + cum1 + L_*w;
-
-        const Real d = 1.0/(b-a);
-
-        const Real expA = std::exp(a);
-        Real s = chF(0, maturity).real()*(expA-1-a)*d;
-
-        for (Size n=1; n < N_; ++n) {
-            const Real r = n*M_PI*d;
-            const Real U_n = 2.0*d*( 1.0/(1.0 + r*r)
-                *(expA + r*std::sin(r*a) - std::cos(r*a)) - 1.0/r*std::sin(r*a));
-
-            s += U_n*(chF(r, maturity)
-                     *std::exp(std::complex<Real>(0, r*(x-a)))).real();
-        }
-
-        if (payoff->optionType() == Option::Put)
-            results_.value = k*df*s;
-        else if (payoff->optionType() == Option::Call) {
-            const DiscountFactor qf
-                = process->dividendYield()->discount(maturityDate);
-            results_.value = spot*qf - k*df*(1-s);
-        }
-        else
-            QL_FAIL("unknown payoff type");
+
+        return chainPricer(maturity).values(payoffs, fwd, df);
+    }
+
+    COSChainPricer COSHestonEngine::chainPricer(Time t) const {
+        return COSChainPricer(
+            [&](Real u) -> std::complex<Real> { return chF(u, t); },
+            c1(t), c2(t), L_, N_);
     }
 
     Real COSHestonEngine::muT(Time t) const {
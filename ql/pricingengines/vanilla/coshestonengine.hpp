@@ -27,6 +27,7 @@
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/pricingengines/genericmodelengine.hpp>
+#include <ql/pricingengines/vanilla/coschainpricer.hpp>
 
 #include <complex>
 
@@ -61,6 +62,14 @@ namespace QuantLib {
         void update() override;
         void calculate() const override;
 
+        //! values of all options with the given payoffs and maturity
+        /*! The characteristic function is evaluated only once and
+            shared by all strikes, see COSChainPricer.
+        */
+        std::vector<Real> priceChain(
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+            const Date& maturityDate) const;
+
         // normalized characteristic function
         std::complex<Real> chF(Real u, Real t) const;
 
@@ -76,6 +85,7 @@ namespace QuantLib {
 
       private:
         Real muT(Time t) const;
+        COSChainPricer chainPricer(Time t) const;
 
         const Real L_;
         const Size N_;
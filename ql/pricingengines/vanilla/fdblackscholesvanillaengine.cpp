@@ -68,6 +68,14 @@ namespace QuantLib {
         registerWith(quantoHelper_);
     }
 
+    void FdBlackScholesVanillaEngine::enableMesherCaching(
+        const ext::shared_ptr<FdmMesherCache>& cache) {
+        mesherCache_ = cache;
+        if (mesherCache_ != nullptr) {
+            mesherCache_->registerWith(process_);
+            mesherCache_->registerWith(quantoHelper_);
+        }
+    }
 
     void FdBlackScholesVanillaEngine::calculate() const {
         // 0. Cash dividend model
@@ -117,14 +125,32 @@ namespace QuantLib {
         const ext::shared_ptr<StrikedTypePayoff> payoff =
             ext::dynamic_pointer_cast<StrikedTypePayoff>(arguments_.payoff);
 
-        const ext::shared_ptr<Fdm1dMesher> equityMesher =
-            ext::make_shared<FdmBlackScholesMesher>(
-                    xGrid_, process_, maturity, payoff->strike(), 
-                    Null<Real>(), Null<Real>(), 0.0001, 1.5, 
+        const auto buildEquityMesher = [&]() -> ext::shared_ptr<Fdm1dMesher> {
+            return ext::make_shared<FdmBlackScholesMesher>(
+                    xGrid_, process_, maturity, payoff->strike(),
+                    Null<Real>(), Null<Real>(), 0.0001, 1.5,
                     std::pair<Real, Real>(payoff->strike(), 0.1),
                     dividendSchedule, quantoHelper_,
                     spotAdjustment);
-        
+        };
+
+        ext::shared_ptr<Fdm1dMesher> equityMesher;
+        if (mesherCache_ != nullptr) {
+            std::vector<Real> parameters = {
+                Real(xGrid_), maturity, payoff->strike(), spotAdjustment };
+            for (const auto& cf: dividendSchedule) {
+                parameters.push_back(process_->time(cf->date()));
+                parameters.push_back(cf->amount());
+            }
+            equityMesher = mesherCache_->mesher(
+                FdmMesherCache::Key(FdmMesherCache::BlackScholes,
+                                    { process_, quantoHelper_ },
+                                    parameters),
+                buildEquityMesher);
+        }
+        else
+            equityMesher = buildEquityMesher();
+
         const ext::shared_ptr<FdmMesher> mesher =
             ext::make_shared<FdmMesherComposite>(equityMesher);
         
@@ -231,15 +257,28 @@ namespace QuantLib {
         return *this;
     }
 
+    MakeFdBlackScholesVanillaEngine&
+    MakeFdBlackScholesVanillaEngine::withMesherCache(
+        const ext::shared_ptr<FdmMesherCache>& mesherCache) {
+        mesherCache_ = mesherCache;
+        return *this;
+    }
+
     MakeFdBlackScholesVanillaEngine::operator
     ext::shared_ptr<PricingEngine>() const {
-        return ext::make_shared<FdBlackScholesVanillaEngine>(
-            process_,
-            quantoHelper_,
-            tGrid_, xGrid_, dampingSteps_,
-            *schemeDesc_,
-            localVol_,
-            illegalLocalVolOverwrite_,
-            cashDividendModel_);
+        const ext::shared_ptr<FdBlackScholesVanillaEngine> engine =
+            ext::make_shared<FdBlackScholesVanillaEngine>(
+                process_,
+                quantoHelper_,
+                tGrid_, xGrid_, dampingSteps_,
+                *schemeDesc_,
+                localVol_,
+                illegalLocalVolOverwrite_,
+                cashDividendModel_);
+
+        if (mesherCache_ != nullptr)
+            engine->enableMesherCaching(mesherCache_);
+
+        return engine;
     }
 }
@@ -29,6 +29,7 @@
 #include <ql/pricingengine.hpp>
 #include <ql/instruments/dividendvanillaoption.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmmeshercache.hpp>
 
 namespace QuantLib {
 
@@ -70,6 +71,19 @@ namespace QuantLib {
 
         void calculate() const override;
 
+        /*! reuse the equity mesher between calls with the same
+            maturity, strike and dividends. The cache is flushed
+            whenever the process changes.
+
+            The Black-Scholes mesher is concentrated around the strike,
+            therefore the cache only hits for options sharing the
+            strike, e.g., calls and puts or European and American
+            options on the same strike of a chain.
+        */
+        void enableMesherCaching(const ext::shared_ptr<FdmMesherCache>& cache =
+                                     ext::make_shared<FdmMesherCache>());
+        const ext::shared_ptr<FdmMesherCache>& mesherCache() const { return mesherCache_; }
+
       private:
         const ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
         const Size tGrid_, xGrid_, dampingSteps_;
@@ -78,6 +92,7 @@ namespace QuantLib {
         const Real illegalLocalVolOverwrite_;
         const ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
         const CashDividendModel cashDividendModel_;
+        ext::shared_ptr<FdmMesherCache> mesherCache_;
     };
 
 
@@ -104,6 +119,9 @@ namespace QuantLib {
         MakeFdBlackScholesVanillaEngine& withCashDividendModel(
             FdBlackScholesVanillaEngine::CashDividendModel cashDividendModel);
 
+        MakeFdBlackScholesVanillaEngine& withMesherCache(
+            const ext::shared_ptr<FdmMesherCache>& mesherCache);
+
         operator ext::shared_ptr<PricingEngine>() const;
       private:
         ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -113,6 +131,7 @@ namespace QuantLib {
         Real illegalLocalVolOverwrite_;
         ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
         FdBlackScholesVanillaEngine::CashDividendModel cashDividendModel_;
+        ext::shared_ptr<FdmMesherCache> mesherCache_;
     };
 }
 
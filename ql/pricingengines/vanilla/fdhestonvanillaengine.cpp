@@ -75,9 +75,23 @@ namespace QuantLib {
         // 1.1 The variance mesher
         const Size tGridMin = 5;
         const Size tGridAvgSteps = std::max(tGridMin, tGrid_/50);
-        const ext::shared_ptr<FdmHestonLocalVolatilityVarianceMesher> vMesher
-            = ext::make_shared<FdmHestonLocalVolatilityVarianceMesher>(
-                  vGrid_, process, leverageFct_, maturity, tGridAvgSteps, 0.0001, mixingFactor_);
+        const auto buildVarianceMesher = [&]() -> ext::shared_ptr<Fdm1dMesher> {
+            return ext::make_shared<FdmHestonLocalVolatilityVarianceMesher>(
+                vGrid_, process, leverageFct_, maturity, tGridAvgSteps, 0.0001, mixingFactor_);
+        };
+
+        const ext::shared_ptr<FdmHestonLocalVolatilityVarianceMesher> vMesher =
+            ext::dynamic_pointer_cast<FdmHestonLocalVolatilityVarianceMesher>(
+                (mesherCache_ != nullptr)
+                    ? mesherCache_->mesher(
+                          FdmMesherCache::Key(
+                              FdmMesherCache::HestonVariance,
+                              { model_.currentLink(), leverageFct_ },
+                              { Real(vGrid_), maturity,
+                                Real(tGridAvgSteps), mixingFactor_ }),
+                          buildVarianceMesher)
+                    : buildVarianceMesher());
+        QL_REQUIRE(vMesher, "local volatility variance mesher expected");
 
         const Volatility avgVolaEstimate = vMesher->volaEstimate();
 
@@ -85,33 +99,52 @@ namespace QuantLib {
         const ext::shared_ptr<StrikedTypePayoff> payoff =
             ext::dynamic_pointer_cast<StrikedTypePayoff>(arguments_.payoff);
 
+        const auto buildEquityMesher = [&]() -> ext::shared_ptr<Fdm1dMesher> {
+            if (strikes_.empty()) {
+                return ext::shared_ptr<Fdm1dMesher>(
+                    new FdmBlackScholesMesher(
+                        xGrid_,
+                        FdmBlackScholesMesher::processHelper(
+                            process->s0(), process->dividendYield(),
+                            process->riskFreeRate(), avgVolaEstimate),
+                        maturity, payoff->strike(),
+                        Null<Real>(), Null<Real>(), 0.0001, 2.0,
+                        std::pair<Real, Real>(payoff->strike(), 0.1),
+                        arguments_.cashFlow,
+                        quantoHelper_));
+            }
+            else {
+                QL_REQUIRE(arguments_.cashFlow.empty(),"multiple strikes engine "
+                           "does not work with discrete dividends");
+                return ext::shared_ptr<Fdm1dMesher>(
+                    new FdmBlackScholesMultiStrikeMesher(
+                        xGrid_,
+                        FdmBlackScholesMesher::processHelper(
+                          process->s0(), process->dividendYield(),
+                          process->riskFreeRate(), avgVolaEstimate),
+                        maturity, strikes_, 0.0001, 1.5,
+                        std::pair<Real, Real>(payoff->strike(), 0.075)));
+            }
+        };
+
         ext::shared_ptr<Fdm1dMesher> equityMesher;
-        if (strikes_.empty()) {
-            equityMesher = ext::shared_ptr<Fdm1dMesher>(
-                new FdmBlackScholesMesher(
-                    xGrid_, 
-                    FdmBlackScholesMesher::processHelper(
-                        process->s0(), process->dividendYield(),
-                        process->riskFreeRate(), avgVolaEstimate),
-                    maturity, payoff->strike(),
-                    Null<Real>(), Null<Real>(), 0.0001, 2.0,
-                    std::pair<Real, Real>(payoff->strike(), 0.1),
-                    arguments_.cashFlow,
-                    quantoHelper_));
-        }
-        else {
-            QL_REQUIRE(arguments_.cashFlow.empty(),"multiple strikes engine "
-                       "does not work with discrete dividends");
-            equityMesher = ext::shared_ptr<Fdm1dMesher>(
-                new FdmBlackScholesMultiStrikeMesher(
-                    xGrid_,
-                    FdmBlackScholesMesher::processHelper(
-                      process->s0(), process->dividendYield(), 
-                      process->riskFreeRate(), avgVolaEstimate),
-                    maturity, strikes_, 0.0001, 1.5,
-                    std::pair<Real, Real>(payoff->strike(), 0.075)));            
+        if (mesherCache_ != nullptr) {
+            std::vector<Real> parameters = {
+                Real(xGrid_), maturity, payoff->strike(), avgVolaEstimate };
+            parameters.insert(parameters.end(), strikes_.begin(), strikes_.end());
+            for (const auto& cf: arguments_.cashFlow) {
+                parameters.push_back(process->time(cf->date()));
+                parameters.push_back(cf->amount());
+            }
+            equityMesher = mesherCache_->mesher(
+                FdmMesherCache::Key(FdmMesherCache::BlackScholes,
+                                    { model_.currentLink(), quantoHelper_ },
+                                    parameters),
+                buildEquityMesher);
         }
-        
+        else
+            equityMesher = buildEquityMesher();
+
         const ext::shared_ptr<FdmMesher> mesher(
             new FdmMesherComposite(equityMesher, vMesher));
 
@@ -208,6 +241,18 @@ namespace QuantLib {
         cachedArgs2results_.clear();
     }
 
+    void FdHestonVanillaEngine::enableMesherCaching(
+        const ext::shared_ptr<FdmMesherCache>& cache) {
+        mesherCache_ = cache;
+        if (mesherCache_ != nullptr) {
+            // the handle notifies both on relinking and on changes
+            // of the linked model
+            mesherCache_->registerWith(model_);
+            mesherCache_->registerWith(leverageFct_);
+            mesherCache_->registerWith(quantoHelper_);
+        }
+    }
+
 
     MakeFdHestonVanillaEngine::MakeFdHestonVanillaEngine(ext::shared_ptr<HestonModel> hestonModel)
     : hestonModel_(std::move(hestonModel)), tGrid_(100), xGrid_(100), vGrid_(50), dampingSteps_(0),
@@ -259,13 +304,26 @@ namespace QuantLib {
         return *this;
     }
 
+    MakeFdHestonVanillaEngine&
+    MakeFdHestonVanillaEngine::withMesherCache(
+        const ext::shared_ptr<FdmMesherCache>& mesherCache) {
+        mesherCache_ = mesherCache;
+        return *this;
+    }
+
     MakeFdHestonVanillaEngine::operator
     ext::shared_ptr<PricingEngine>() const {
-        return ext::make_shared<FdHestonVanillaEngine>(
-            hestonModel_,
-            quantoHelper_,
-            tGrid_, xGrid_, vGrid_, dampingSteps_,
-            *schemeDesc_,
-            leverageFct_);
+        const ext::shared_ptr<FdHestonVanillaEngine> engine =
+            ext::make_shared<FdHestonVanillaEngine>(
+                hestonModel_,
+                quantoHelper_,
+                tGrid_, xGrid_, vGrid_, dampingSteps_,
+                *schemeDesc_,
+                leverageFct_);
+
+        if (mesherCache_ != nullptr)
+            engine->enableMesherCaching(mesherCache_);
+
+        return engine;
     }
 }
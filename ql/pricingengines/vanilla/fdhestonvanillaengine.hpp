@@ -31,6 +31,7 @@
 #include <ql/pricingengines/genericmodelengine.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmsolverdesc.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmmeshercache.hpp>
 #include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
 
 namespace QuantLib {
@@ -78,7 +79,17 @@ namespace QuantLib {
         // multiple strikes caching engine
         void update() override;
         void enableMultipleStrikesCaching(const std::vector<Real>& strikes);
-        
+
+        /*! reuse the variance and equity meshers between calls with
+            the same maturity, strike and dividends. The variance
+            mesher does not depend on the strike and is shared by all
+            options with the same maturity. The cache is flushed
+            whenever the model or the leverage function changes.
+        */
+        void enableMesherCaching(const ext::shared_ptr<FdmMesherCache>& cache =
+                                     ext::make_shared<FdmMesherCache>());
+        const ext::shared_ptr<FdmMesherCache>& mesherCache() const { return mesherCache_; }
+
         // helper method for Heston like engines
         FdmSolverDesc getSolverDesc(Real equityScaleFactor) const;
 
@@ -93,6 +104,7 @@ namespace QuantLib {
         mutable std::vector<std::pair<DividendVanillaOption::arguments,
                                       DividendVanillaOption::results> >
                                                             cachedArgs2results_;
+        ext::shared_ptr<FdmMesherCache> mesherCache_;
     };
 
     class MakeFdHestonVanillaEngine {
@@ -114,6 +126,9 @@ namespace QuantLib {
         MakeFdHestonVanillaEngine& withLeverageFunction(
             ext::shared_ptr<LocalVolTermStructure>& leverageFct);
 
+        MakeFdHestonVanillaEngine& withMesherCache(
+            const ext::shared_ptr<FdmMesherCache>& mesherCache);
+
         operator ext::shared_ptr<PricingEngine>() const;
 
       private:
@@ -122,6 +137,7 @@ namespace QuantLib {
         ext::shared_ptr<FdmSchemeDesc> schemeDesc_;
         ext::shared_ptr<LocalVolTermStructure> leverageFct_;
         ext::shared_ptr<FdmQuantoHelper> quantoHelper_;
+        ext::shared_ptr<FdmMesherCache> mesherCache_;
     };
 }
 
@@ -103,4 +103,62 @@ namespace QuantLib {
     Real AbcdSquared::operator()(Time t) const {
         return abcd_->covariance(t, T_, S_);
     }
+
+
+    namespace {
+
+        // \int_0^T u^n e^{-k u} du
+        Real exponentialMoment(Size n, Real k, Time T) {
+            const Real kT = k*T;
+            if (kT < 1.0) {
+                // power series, avoids the cancellation of the closed form
+                Real term = std::pow(T, Real(n+1)), sum = 0.0;
+                for (Size m=0; m<50; ++m) {
+                    const Real contribution = term/(n+m+1);
+                    sum += contribution;
+                    if (std::fabs(contribution) < QL_EPSILON*std::fabs(sum))
+                        break;
+                    term *= -kT/(m+1);
+                }
+                return sum;
+            }
+            Real partialSum = 0.0, term = 1.0, factorial = 1.0;
+            for (Size j=0; j<=n; ++j) {
+                partialSum += term;
+                term *= kT/(j+1);
+                if (j>0)
+                    factorial *= j;
+            }
+            return factorial/std::pow(k, Real(n+1))
+                * (1.0 - std::exp(-kT)*partialSum);
+        }
+
+    }
+
+    Disposable<Array> abcdBlackVolatilityGradient(Time u,
+                                                  Real a, Real b,
+                                                  Real c, Real d) {
+        QL_REQUIRE(u>0.0, "positive time required: " << u << " not allowed");
+
+        // the variance is \int_0^u ([a+b s]e^{-cs}+d)^2 ds
+        const Real i0 = exponentialMoment(0, 2.0*c, u),
+                   i1 = exponentialMoment(1, 2.0*c, u),
+                   i2 = exponentialMoment(2, 2.0*c, u),
+                   i3 = exponentialMoment(3, 2.0*c, u);
+        const Real j0 = exponentialMoment(0, c, u),
+                   j1 = exponentialMoment(1, c, u),
+                   j2 = exponentialMoment(2, c, u);
+
+        const Real sigma = abcdBlackVolatility(u, a, b, c, d);
+        const Real factor = 1.0/(2.0*u*sigma);
+
+        Array gradient(4);
+        gradient[0] = 2.0*(a*i0 + b*i1 + d*j0) * factor;
+        gradient[1] = 2.0*(a*i1 + b*i2 + d*j1) * factor;
+        gradient[2] = -2.0*(a*a*i1 + 2.0*a*b*i2 + b*b*i3
+                            + d*(a*j1 + b*j2)) * factor;
+        gradient[3] = 2.0*(a*j0 + b*j1 + d*u) * factor;
+        return gradient;
+    }
+
 }
@@ -25,6 +25,7 @@
 #include <ql/types.hpp>
 #include <ql/errors.hpp>
 #include <ql/math/abcdmathfunction.hpp>
+#include <ql/math/array.hpp>
 
 namespace QuantLib {
     
@@ -108,6 +109,13 @@ namespace QuantLib {
         AbcdFunction model(a,b,c,d);
         return model.volatility(0.,u,u);
     }
+
+    /*! returns the derivatives of abcdBlackVolatility(u,a,b,c,d) with
+        respect to a, b, c and d
+    */
+    Disposable<Array> abcdBlackVolatilityGradient(Time u,
+                                                  Real a, Real b,
+                                                  Real c, Real d);
 }
 
 #endif
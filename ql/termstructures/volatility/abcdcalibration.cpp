@@ -51,6 +51,43 @@ namespace QuantLib {
         return y_;
     }
 
+    void AbcdCalibration::AbcdError::jacobian(Matrix& jac,
+                                              const Array& x) const {
+        const Array y = abcd_->transformation_->direct(x);
+        abcd_->a_ = y[0];
+        abcd_->b_ = y[1];
+        abcd_->c_ = y[2];
+        abcd_->d_ = y[3];
+        // chain rule through AbcdParametersTransformation::direct
+        const Real ex0 = std::exp(x[0]), ex2 = std::exp(x[2]),
+                   ex3 = std::exp(x[3]);
+        for (Size i=0; i<abcd_->times_.size(); ++i) {
+            const Array g = abcdBlackVolatilityGradient(
+                abcd_->times_[i], y[0], y[1], y[2], y[3]);
+            const Real w = std::sqrt(abcd_->weights_[i]);
+            jac[i][0] = w * g[0] * ex0;
+            jac[i][1] = w * g[1];
+            jac[i][2] = w * g[2] * ex2;
+            jac[i][3] = w * (g[3] - g[0]) * ex3;
+        }
+    }
+
+    void AbcdCalibration::AbcdError::gradient(Array& grad,
+                                              const Array& x) const {
+        // value() is sqrt(n/(n-1) sum_i e_i^2) with e the weighted errors
+        Matrix jac(abcd_->times_.size(), x.size());
+        jacobian(jac, x);
+        const Array e = abcd_->errors();
+        const Real error = abcd_->error();
+        const Size n = e.size();
+        for (Size j=0; j<x.size(); ++j) {
+            Real sum = 0.0;
+            for (Size i=0; i<n; ++i)
+                sum += e[i] * jac[i][j];
+            grad[j] = error > 0.0 ? n * sum / ((n-1) * error) : 0.0;
+        }
+    }
+
     // to constrained <- from unconstrained
 
     AbcdCalibration::AbcdCalibration(const std::vector<Real>& t,
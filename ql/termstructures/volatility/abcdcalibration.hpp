@@ -61,6 +61,9 @@ namespace QuantLib {
                 abcd_->d_ = y[3];
                 return abcd_->errors();
             }
+            void gradient(Array& grad, const Array& x) const override;
+            void jacobian(Matrix& jac, const Array& x) const override;
+            bool hasAnalyticDerivatives() const override { return true; }
 
           private:
             AbcdCalibration* abcd_;
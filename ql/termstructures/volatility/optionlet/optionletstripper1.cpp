@@ -31,6 +31,7 @@
 #include <ql/indexes/iborindex.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <sstream>
 
 namespace QuantLib {
 
@@ -115,12 +116,17 @@ namespace QuantLib {
             QL_FAIL("unknown volatility type: " << volatilityType_);
         }
 
+        std::vector<DiscountFactor> optionletAnnuities(nOptionletTenors_);
+        for (Size i=0; i<nOptionletTenors_; ++i) {
+            DiscountFactor d =
+                discountCurve->discount(optionletPaymentDates_[i]);
+            optionletAnnuities[i] = optionletAccrualPeriods_[i]*d;
+        }
+
         for (Size j=0; j<nStrikes_; ++j) {
             // using out-of-the-money options
             CapFloor::Type capFloorType =
                 strikes[j] < switchStrike_ ? CapFloor::Floor : CapFloor::Cap;
-            Option::Type optionletType =
-                strikes[j] < switchStrike_ ? Option::Put : Option::Call;
 
             Real previousCapFloorPrice = 0.0;
             for (Size i=0; i<nOptionletTenors_; ++i) {
@@ -136,43 +142,66 @@ namespace QuantLib {
                 optionletPrices_[i][j] = capFloorPrices_[i][j] -
                                                         previousCapFloorPrice;
                 previousCapFloorPrice = capFloorPrices_[i][j];
-                DiscountFactor d =
-                    discountCurve->discount(optionletPaymentDates_[i]);
-                DiscountFactor optionletAnnuity=optionletAccrualPeriods_[i]*d;
-                try {
-                  if (volatilityType_ == ShiftedLognormal) {
-                    optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
+            }
+        }
+
+        // once the optionlet prices are known, the inversions are
+        // independent of one another and can be performed in parallel;
+        // the reported error, if any, is the one of the first optionlet
+        // met by the sequential loop over strikes and tenors.
+        const long nOptionlets =
+            static_cast<long>(nOptionletTenors_*nStrikes_);
+        long failedOptionlet = nOptionlets;
+        std::string error;
+        #pragma omp parallel for
+        for (long k=0; k<nOptionlets; ++k) {
+            Size j = k / nOptionletTenors_, i = k % nOptionletTenors_;
+            Option::Type optionletType =
+                strikes[j] < switchStrike_ ? Option::Put : Option::Call;
+            try {
+              if (volatilityType_ == ShiftedLognormal) {
+                optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
+                    optionletType, strikes[j], atmOptionletRate_[i],
+                    optionletPrices_[i][j], optionletAnnuities[i],
+                    displacement_, optionletStDevs_[i][j], accuracy_,
+                    maxIter_);
+              } else if (volatilityType_ == Normal) {
+                optionletStDevs_[i][j] =
+                    std::sqrt(optionletTimes_[i]) *
+                    bachelierBlackFormulaImpliedVol(
                         optionletType, strikes[j], atmOptionletRate_[i],
-                        optionletPrices_[i][j], optionletAnnuity, displacement_,
-                        optionletStDevs_[i][j], accuracy_, maxIter_);
-                  } else if (volatilityType_ == Normal) {
-                    optionletStDevs_[i][j] =
-                        std::sqrt(optionletTimes_[i]) *
-                        bachelierBlackFormulaImpliedVol(
-                            optionletType, strikes[j], atmOptionletRate_[i],
-                            optionletTimes_[i], optionletPrices_[i][j],
-                            optionletAnnuity);
-                  } else {
-                    QL_FAIL("Unknown volatility type: " << volatilityType_);
-                  }
-                }
-                catch (std::exception &e) {
-                    if(dontThrow_)
-                        optionletStDevs_[i][j]=0.0;
-                    else
-                        QL_FAIL("could not bootstrap optionlet:"
-                            "\n type:    " << optionletType <<
-                            "\n strike:  " << io::rate(strikes[j]) <<
-                            "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
-                            "\n price:   " << optionletPrices_[i][j] <<
-                            "\n annuity: " << optionletAnnuity <<
-                            "\n expiry:  " << optionletDates_[i] <<
-                            "\n error:   " << e.what());
+                        optionletTimes_[i], optionletPrices_[i][j],
+                        optionletAnnuities[i]);
+              } else {
+                QL_FAIL("Unknown volatility type: " << volatilityType_);
+              }
+            }
+            catch (std::exception &e) {
+                if(dontThrow_)
+                    optionletStDevs_[i][j]=0.0;
+                else {
+                    std::ostringstream message;
+                    message << "could not bootstrap optionlet:"
+                        "\n type:    " << optionletType <<
+                        "\n strike:  " << io::rate(strikes[j]) <<
+                        "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
+                        "\n price:   " << optionletPrices_[i][j] <<
+                        "\n annuity: " << optionletAnnuities[i] <<
+                        "\n expiry:  " << optionletDates_[i] <<
+                        "\n error:   " << e.what();
+                    #pragma omp critical
+                    {
+                        if (k < failedOptionlet) {
+                            failedOptionlet = k;
+                            error = message.str();
+                        }
+                    }
                 }
-                optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
-                                                std::sqrt(optionletTimes_[i]);
             }
+            optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
+                                            std::sqrt(optionletTimes_[i]);
         }
+        QL_REQUIRE(error.empty(), error);
 
     }
 
@@ -29,6 +29,64 @@
 
 namespace QuantLib {
 
+    namespace {
+        /* Hagan et al. formula with the strike-independent terms
+           computed once, shared by the scalar and the vectorized
+           versions below so that both return identical results.
+        */
+        class SabrVolatilityKernel {
+          public:
+            SabrVolatilityKernel(Rate forward,
+                                 Time expiryTime,
+                                 Real alpha,
+                                 Real beta,
+                                 Real nu,
+                                 Real rho)
+            : forward_(forward), expiryTime_(expiryTime), alpha_(alpha),
+              rho_(rho), oneMinusBeta_(1.0-beta),
+              nuOverAlpha_(nu/alpha),
+              dTerm1_(oneMinusBeta_*oneMinusBeta_*alpha*alpha),
+              dTerm2_(0.25*rho*beta*nu*alpha),
+              dTerm3_((2.0-3.0*rho*rho)*(nu*nu/24.0)),
+              ratio_(3.0*rho*rho-2.0) {}
+
+            Real operator()(Rate strike) const {
+                const Real A = std::pow(forward_*strike, oneMinusBeta_);
+                const Real sqrtA= std::sqrt(A);
+                Real logM;
+                if (!close(forward_, strike))
+                    logM = std::log(forward_/strike);
+                else {
+                    const Real epsilon = (forward_-strike)/strike;
+                    logM = epsilon - .5 * epsilon * epsilon ;
+                }
+                const Real z = nuOverAlpha_*sqrtA*logM;
+                const Real B = 1.0-2.0*rho_*z+z*z;
+                const Real C = oneMinusBeta_*oneMinusBeta_*logM*logM;
+                const Real tmp = (std::sqrt(B)+z-rho_)/(1.0-rho_);
+                const Real xx = std::log(tmp);
+                const Real D = sqrtA*(1.0+C/24.0+C*C/1920.0);
+                const Real d = 1.0 + expiryTime_ *
+                    (dTerm1_/(24.0*A) + dTerm2_/sqrtA + dTerm3_);
+
+                Real multiplier;
+                // computations become precise enough if the square of z worth
+                // slightly more than the precision machine (hence the m)
+                static const Real m = 10;
+                if (std::fabs(z*z)>QL_EPSILON * m)
+                    multiplier = z/xx;
+                else {
+                    multiplier = 1.0 - 0.5*rho_*z - ratio_*z*z/12.0;
+                }
+                return (alpha_/D)*multiplier*d;
+            }
+
+          private:
+            Real forward_, expiryTime_, alpha_, rho_, oneMinusBeta_;
+            Real nuOverAlpha_, dTerm1_, dTerm2_, dTerm3_, ratio_;
+        };
+    }
+
     Real unsafeSabrVolatility(Rate strike,
                               Rate forward,
                               Time expiryTime,
@@ -36,7 +94,58 @@ namespace QuantLib {
                               Real beta,
                               Real nu,
                               Real rho) {
+        return SabrVolatilityKernel(forward, expiryTime,
+                                    alpha, beta, nu, rho)(strike);
+    }
+
+    std::vector<Volatility> sabrVolatilities(const std::vector<Rate>& strikes,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho) {
+        return shiftedSabrVolatilities(strikes, forward, expiryTime,
+                                       alpha, beta, nu, rho, 0.0);
+    }
+
+    std::vector<Volatility> shiftedSabrVolatilities(
+                                             const std::vector<Rate>& strikes,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho,
+                                             Real shift) {
+        QL_REQUIRE(forward + shift > 0.0, "at the money forward rate + shift must be "
+                   "positive: " << io::rate(forward) << " " << io::rate(shift) << " not allowed");
+        QL_REQUIRE(expiryTime>=0.0, "expiry time must be non-negative: "
+                                   << expiryTime << " not allowed");
+        validateSabrParameters(alpha, beta, nu, rho);
+        const SabrVolatilityKernel kernel(forward+shift, expiryTime,
+                                          alpha, beta, nu, rho);
+        std::vector<Volatility> result(strikes.size());
+        for (Size i=0; i<strikes.size(); ++i) {
+            QL_REQUIRE(strikes[i] + shift > 0.0,
+                       "strike+shift must be positive: "
+                       << io::rate(strikes[i]) << "+" << io::rate(shift)
+                       << " not allowed");
+            result[i] = kernel(strikes[i]+shift);
+        }
+        return result;
+    }
+
+    Real unsafeSabrVolatilityAndGradient(Rate strike,
+                                         Rate forward,
+                                         Time expiryTime,
+                                         Real alpha,
+                                         Real beta,
+                                         Real nu,
+                                         Real rho,
+                                         Array& gradient) {
         const Real oneMinusBeta = 1.0-beta;
+        const Real logFK = std::log(forward*strike);
         const Real A = std::pow(forward*strike, oneMinusBeta);
         const Real sqrtA= std::sqrt(A);
         Real logM;
@@ -48,25 +157,64 @@ namespace QuantLib {
         }
         const Real z = (nu/alpha)*sqrtA*logM;
         const Real B = 1.0-2.0*rho*z+z*z;
+        const Real sqrtB = std::sqrt(B);
         const Real C = oneMinusBeta*oneMinusBeta*logM*logM;
-        const Real tmp = (std::sqrt(B)+z-rho)/(1.0-rho);
+        const Real tmp = (sqrtB+z-rho)/(1.0-rho);
         const Real xx = std::log(tmp);
-        const Real D = sqrtA*(1.0+C/24.0+C*C/1920.0);
+        const Real D0 = 1.0+C/24.0+C*C/1920.0;
+        const Real D = sqrtA*D0;
         const Real d = 1.0 + expiryTime *
             (oneMinusBeta*oneMinusBeta*alpha*alpha/(24.0*A)
                                 + 0.25*rho*beta*nu*alpha/sqrtA
                                     +(2.0-3.0*rho*rho)*(nu*nu/24.0));
 
-        Real multiplier;
-        // computations become precise enough if the square of z worth
-        // slightly more than the precision machine (hence the m)
+        Real multiplier, dMdz, dMdRho;
         static const Real m = 10;
-        if (std::fabs(z*z)>QL_EPSILON * m)
+        if (std::fabs(z*z)>QL_EPSILON * m) {
             multiplier = z/xx;
+            // d xx/dz = 1/sqrt(B)
+            dMdz = (1.0 - multiplier/sqrtB)/xx;
+            const Real dxxdRho =
+                1.0/(1.0-rho) - (z+sqrtB)/(sqrtB*(sqrtB+z-rho));
+            dMdRho = -multiplier/xx*dxxdRho;
+        }
         else {
             multiplier = 1.0 - 0.5*rho*z - (3.0*rho*rho-2.0)*z*z/12.0;
+            dMdz = -0.5*rho - (3.0*rho*rho-2.0)*z/6.0;
+            dMdRho = -0.5*z - 0.5*rho*z*z;
         }
-        return (alpha/D)*multiplier*d;
+        const Real f = alpha/D;
+        const Real vol = f*multiplier*d;
+
+        // derivatives of the building blocks, note that dA/dbeta = -A*logFK
+        const Real dDdBeta = -0.5*sqrtA*logFK*D0
+            - sqrtA*(1.0/24.0 + C/960.0)*2.0*oneMinusBeta*logM*logM;
+
+        const Real dzdAlpha = -z/alpha;
+        const Real dzdBeta = -0.5*logFK*z;
+        const Real dzdNu = sqrtA*logM/alpha;
+
+        const Real dddAlpha = expiryTime *
+            (oneMinusBeta*oneMinusBeta*alpha/(12.0*A)
+             + 0.25*rho*beta*nu/sqrtA);
+        const Real dddBeta = expiryTime *
+            (oneMinusBeta*alpha*alpha/(24.0*A)*(oneMinusBeta*logFK - 2.0)
+             + 0.25*rho*nu*alpha/sqrtA*(1.0 + 0.5*beta*logFK));
+        const Real dddNu = expiryTime *
+            (0.25*rho*beta*alpha/sqrtA + (2.0-3.0*rho*rho)*nu/12.0);
+        const Real dddRho = expiryTime *
+            (0.25*beta*nu*alpha/sqrtA - 0.25*rho*nu*nu);
+
+        if (gradient.size() != 4)
+            gradient = Array(4);
+
+        gradient[0] = vol/alpha + f*d*dMdz*dzdAlpha + f*multiplier*dddAlpha;
+        gradient[1] = -vol/D*dDdBeta + f*d*dMdz*dzdBeta
+            + f*multiplier*dddBeta;
+        gradient[2] = f*d*dMdz*dzdNu + f*multiplier*dddNu;
+        gradient[3] = f*d*dMdRho + f*multiplier*dddRho;
+
+        return vol;
     }
 
     Real unsafeShiftedSabrVolatility(Rate strike,
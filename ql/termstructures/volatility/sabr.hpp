@@ -28,7 +28,8 @@
 #ifndef quantlib_sabr_hpp
 #define quantlib_sabr_hpp
 
-#include <ql/types.hpp>
+#include <ql/math/array.hpp>
+#include <vector>
 
 namespace QuantLib {
 
@@ -40,6 +41,18 @@ namespace QuantLib {
                               Real nu,
                               Real rho);
 
+    /*! returns the Hagan et al. volatility and stores its analytic
+        derivatives with respect to alpha, beta, nu and rho in gradient
+    */
+    Real unsafeSabrVolatilityAndGradient(Rate strike,
+                                         Rate forward,
+                                         Time expiryTime,
+                                         Real alpha,
+                                         Real beta,
+                                         Real nu,
+                                         Real rho,
+                                         Array& gradient);
+
     Real unsafeShiftedSabrVolatility(Rate strike,
                               Rate forward,
                               Time expiryTime,
@@ -66,6 +79,28 @@ namespace QuantLib {
                                  Real rho,
                                  Real shift);
 
+    /*! returns the Hagan et al. volatilities for a set of strikes;
+        the parameters are validated and the strike-independent terms
+        are computed only once.
+    */
+    std::vector<Volatility> sabrVolatilities(const std::vector<Rate>& strikes,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho);
+
+    std::vector<Volatility> shiftedSabrVolatilities(
+                                             const std::vector<Rate>& strikes,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho,
+                                             Real shift);
+
     Real sabrFlochKennedyVolatility(Rate strike,
                                     Rate forward,
                                     Time expiryTime,
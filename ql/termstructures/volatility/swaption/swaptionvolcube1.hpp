@@ -37,6 +37,8 @@
 #include <ql/quote.hpp>
 #include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube.hpp>
+#include <algorithm>
+#include <map>
 #include <utility>
 
 
@@ -46,6 +48,9 @@
 #ifndef SWAPTIONVOLCUBE_TOL
     #define SWAPTIONVOLCUBE_TOL 100.0e-4
 #endif
+#ifndef SWAPTIONVOLCUBE_SMILE_CACHE_SIZE
+    #define SWAPTIONVOLCUBE_SMILE_CACHE_SIZE 4096
+#endif
 
 namespace QuantLib {
 
@@ -65,8 +70,8 @@ namespace QuantLib {
                  Size nLayers,
                  bool extrapolation = true,
                  bool backwardFlat = false);
-            Cube& operator=(const Cube& o);
-            Cube(const Cube&);
+            Cube& operator=(const Cube& o) = default;
+            Cube(const Cube&) = default;
             virtual ~Cube() = default;
             void setElement(Size IndexOfLayer,
                             Size IndexOfRow,
@@ -94,6 +99,10 @@ namespace QuantLib {
             const std::vector<Time>& swapLengths() const;
             const std::vector<Matrix>& points() const;
             std::vector<Real> operator()(Time optionTime, Time swapLengths) const;
+            /*! compiles the current points into the flat representation
+                used by operator(); changes made through the setters are
+                not visible until this is called.
+            */
             void updateInterpolators()const;
             Matrix browse() const;
           private:
@@ -102,10 +111,17 @@ namespace QuantLib {
             std::vector<Period> swapTenors_;
             Size nLayers_;
             std::vector<Matrix> points_;
-            mutable std::vector<Disposable<Matrix> > transposedPoints_;
             bool extrapolation_;
             bool backwardFlat_;
-            mutable std::vector< ext::shared_ptr<Interpolation2D> > interpolators_;
+            /* compiled cube: the grids and, for each layer, the points
+               stored swap length by swap length so that all layers are
+               interpolated with a single lookup of the grid cell
+               (flat extrapolation, bilinear or backward-flat/linear
+               interpolation as in the previous Interpolation2D
+               implementation.)
+            */
+            mutable std::vector<Time> gridOptionTimes_, gridSwapLengths_;
+            mutable std::vector<Real> compiledPoints_;
          };
       public:
         SwaptionVolCube1x(
@@ -178,6 +194,8 @@ namespace QuantLib {
         mutable Cube denseParameters_;
         mutable std::vector< std::vector<ext::shared_ptr<SmileSection> > >
                                                                 sparseSmiles_;
+        mutable std::map<std::pair<Time, Time>, ext::shared_ptr<SmileSection> >
+                                                         smileSectionCache_;
         std::vector<std::vector<Handle<Quote> > > parametersGuessQuotes_;
         mutable Cube parametersGuess_;
         std::vector<bool> isParameterFixed_;
@@ -297,6 +315,7 @@ namespace QuantLib {
     template<class Model> void SwaptionVolCube1x<Model>::performCalculations() const {
 
         SwaptionVolatilityCube::performCalculations();
+        smileSectionCache_.clear();
 
         //! set marketVolCube_ by volSpreads_ quotes
         marketVolCube_ = Cube(optionDates_, swapTenors_,
@@ -330,6 +349,7 @@ namespace QuantLib {
     }
 
     template<class Model> void SwaptionVolCube1x<Model>::updateAfterRecalibration() {
+        smileSectionCache_.clear();
         volCubeAtmCalibrated_ = marketVolCube_;
         if(isAtmCalibrated_){
             fillVolatilityCube();
@@ -785,10 +805,21 @@ namespace QuantLib {
     template<class Model> ext::shared_ptr<SmileSection>
     SwaptionVolCube1x<Model>::smileSectionImpl(Time optionTime,
                                        Time swapLength) const {
-        if (isAtmCalibrated_)
-            return smileSection(optionTime, swapLength, denseParameters_);
-        else
-            return smileSection(optionTime, swapLength, sparseParameters_);
+        calculate();
+        // smile sections only depend on the calibrated parameters, so
+        // they can be shared between queries until the next recalculation
+        std::pair<Time, Time> key(optionTime, swapLength);
+        auto cached = smileSectionCache_.find(key);
+        if (cached != smileSectionCache_.end())
+            return cached->second;
+        ext::shared_ptr<SmileSection> section =
+            isAtmCalibrated_ ?
+            smileSection(optionTime, swapLength, denseParameters_) :
+            smileSection(optionTime, swapLength, sparseParameters_);
+        if (smileSectionCache_.size() >= SWAPTIONVOLCUBE_SMILE_CACHE_SIZE)
+            smileSectionCache_.clear();
+        smileSectionCache_[key] = section;
+        return section;
     }
 
     template<class Model> Matrix SwaptionVolCube1x<Model>::sparseSabrParameters() const {
@@ -840,6 +871,7 @@ namespace QuantLib {
         }
 
         parametersGuess_.updateInterpolators();
+        smileSectionCache_.clear();
         sabrCalibrationSection(marketVolCube_, sparseParameters_, swapTenor);
 
         volCubeAtmCalibrated_ = marketVolCube_;
@@ -912,86 +944,10 @@ namespace QuantLib {
 
         std::vector<Matrix> points(nLayers_, Matrix(optionTimes_.size(),
                                                     swapLengths_.size(), 0.0));
-        for (Size k=0;k<nLayers_;k++) {
-            ext::shared_ptr<Interpolation2D> interpolation;
-            transposedPoints_.push_back(transpose(points[k]));
-            if (k <= 4 && backwardFlat_)
-                interpolation =
-                    ext::make_shared<BackwardflatLinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            else
-                interpolation =
-                    ext::make_shared<BilinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            interpolators_.push_back(ext::shared_ptr<Interpolation2D>(
-                new FlatExtrapolator2D(interpolation)));
-            interpolators_[k]->enableExtrapolation();
-        }
         setPoints(points);
+        updateInterpolators();
      }
 
-    template<class Model> SwaptionVolCube1x<Model>::Cube::Cube(const Cube& o)
-    : optionTimes_(o.optionTimes_), swapLengths_(o.swapLengths_),
-      optionDates_(o.optionDates_), swapTenors_(o.swapTenors_),
-      nLayers_(o.nLayers_), transposedPoints_(o.transposedPoints_),
-      extrapolation_(o.extrapolation_), backwardFlat_(o.backwardFlat_) {
-        for (Size k=0; k<nLayers_; ++k) {
-            ext::shared_ptr<Interpolation2D> interpolation;
-            if (k <= 4 && backwardFlat_)
-                interpolation =
-                    ext::make_shared<BackwardflatLinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            else
-                interpolation =
-                    ext::make_shared<BilinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            interpolators_.push_back(ext::shared_ptr<Interpolation2D>(
-                new FlatExtrapolator2D(interpolation)));
-            interpolators_[k]->enableExtrapolation();
-        }
-        setPoints(o.points_);
-    }
-
-    template<class Model> typename SwaptionVolCube1x<Model>::Cube&
-    SwaptionVolCube1x<Model>::Cube::operator=(const Cube& o) {
-        optionTimes_ = o.optionTimes_;
-        swapLengths_ = o.swapLengths_;
-        optionDates_ = o.optionDates_;
-        swapTenors_ = o.swapTenors_;
-        nLayers_ = o.nLayers_;
-        extrapolation_ = o.extrapolation_;
-        backwardFlat_ = o.backwardFlat_;
-        transposedPoints_ = o.transposedPoints_;
-        for(Size k=0;k<nLayers_;k++){
-            ext::shared_ptr<Interpolation2D> interpolation;
-            if (k <= 4 && backwardFlat_)
-                interpolation =
-                    ext::make_shared<BackwardflatLinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            else
-                interpolation =
-                    ext::make_shared<BilinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            interpolators_.push_back(ext::shared_ptr<Interpolation2D>(
-                new FlatExtrapolator2D(interpolation)));
-            interpolators_[k]->enableExtrapolation();
-        }
-        setPoints(o.points_);
-        return *this;
-    }
-
     template<class Model> void SwaptionVolCube1x<Model>::Cube::setElement(Size IndexOfLayer,
                                                         Size IndexOfRow,
                                                         Size IndexOfColumn,
@@ -1101,9 +1057,38 @@ namespace QuantLib {
 
     template<class Model> std::vector<Real> SwaptionVolCube1x<Model>::Cube::operator()(
                             const Time optionTime, const Time swapLength) const {
-        std::vector<Real> result;
-        for (Size k=0; k<nLayers_; ++k)
-            result.push_back((*interpolators_[k])(optionTime, swapLength));
+        const std::vector<Time>& xs = gridOptionTimes_;
+        const std::vector<Time>& ys = gridSwapLengths_;
+        const Size nx = xs.size(), ny = ys.size();
+
+        // flat extrapolation
+        const Real x = std::min(std::max(optionTime, xs.front()), xs.back());
+        const Real y = std::min(std::max(swapLength, ys.front()), ys.back());
+
+        // grid cell, shared by all layers
+        const Size i =
+            std::upper_bound(xs.begin(), xs.end()-1, x) - xs.begin() - 1;
+        const Size j =
+            std::upper_bound(ys.begin(), ys.end()-1, y) - ys.begin() - 1;
+        const Real t = (x-xs[i])/(xs[i+1]-xs[i]);
+        const Real u = (y-ys[j])/(ys[j+1]-ys[j]);
+
+        // backward-flat node in option time direction
+        const Size iFlat = x <= xs[0] ? 0 : (x == xs[i] ? i : i+1);
+
+        std::vector<Real> result(nLayers_);
+        for (Size k=0; k<nLayers_; ++k) {
+            const Real* z = &compiledPoints_[(k*ny+j)*nx];
+            if (k <= 4 && backwardFlat_) {
+                const Real z1 = z[iFlat], z2 = z[nx+iFlat];
+                result[k] = (1.0-u)*z1 + u*z2;
+            } else {
+                const Real z1 = z[i], z2 = z[i+1];
+                const Real z3 = z[nx+i], z4 = z[nx+i+1];
+                result[k] = (1.0-t)*(1.0-u)*z1 + t*(1.0-u)*z2
+                          + (1.0-t)*u*z3 + t*u*z4;
+            }
+        }
         return result;
     }
 
@@ -1118,25 +1103,14 @@ namespace QuantLib {
     }
 
     template<class Model> void SwaptionVolCube1x<Model>::Cube::updateInterpolators() const {
-        for (Size k = 0; k < nLayers_; ++k) {
-            transposedPoints_[k] = transpose(points_[k]);
-            ext::shared_ptr<Interpolation2D> interpolation;
-            if (k <= 4 && backwardFlat_)
-                interpolation =
-                    ext::make_shared<BackwardflatLinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            else
-                interpolation =
-                    ext::make_shared<BilinearInterpolation>(
-                        optionTimes_.begin(), optionTimes_.end(),
-                        swapLengths_.begin(), swapLengths_.end(),
-                        transposedPoints_[k]);
-            interpolators_[k] = ext::shared_ptr<Interpolation2D>(
-                new FlatExtrapolator2D(interpolation));
-            interpolators_[k]->enableExtrapolation();
-        }
+        gridOptionTimes_ = optionTimes_;
+        gridSwapLengths_ = swapLengths_;
+        const Size nx = optionTimes_.size(), ny = swapLengths_.size();
+        compiledPoints_.resize(nLayers_*ny*nx);
+        for (Size k=0; k<nLayers_; ++k)
+            for (Size j=0; j<ny; ++j)
+                for (Size i=0; i<nx; ++i)
+                    compiledPoints_[(k*ny+j)*nx+i] = points_[k][i][j];
     }
 
     template<class Model> Matrix SwaptionVolCube1x<Model>::Cube::browse() const {
@@ -116,6 +116,13 @@
 //#    define QL_ENABLE_PARALLEL_UNIT_TEST_RUNNER
 #endif
 
+/* Define this to dispatch dense matrix products, Cholesky, symmetric
+   eigenvalue and singular value decompositions to a system BLAS/LAPACK
+   library. The library must be linked to QuantLib and its clients. */
+#ifndef QL_USE_BLAS_LAPACK
+//#    define QL_USE_BLAS_LAPACK
+#endif
+
 /* Define this to make Singleton initialization thread-safe.
    Note: There is no support for thread safety and multiple sessions.
 */
@@ -434,6 +434,129 @@ void BlackFormulaTest::testBachelierBlackFormulaForwardDerivativeWithZeroVolatil
     assertBachelierBlackFormulaForwardDerivative(Option::Put, strikes, vol);
 }
 
+void BlackFormulaTest::testBatchedFormulas() {
+
+    BOOST_TEST_MESSAGE("Testing batched Black and Bachelier formulas...");
+
+    // the grid includes zero strikes and zero standard deviations,
+    // which are handled by special branches in the scalar formulas
+    const Real strikeValues[] = { 0.0, 0.005, 0.02, 0.03, 0.05, 0.12 };
+    const Real forwardValues[] = { 0.01, 0.03, 0.07 };
+    const Real stdDevValues[] = { 0.0, 0.05, 0.2, 0.8 };
+    const Real displacements[] = { 0.0, 0.02 };
+    const Option::Type types[] = { Option::Call, Option::Put };
+
+    const Size n = LENGTH(strikeValues)*LENGTH(forwardValues)
+        *LENGTH(stdDevValues);
+    Array strikes(n), forwards(n), stdDevs(n), discounts(n);
+    Size k = 0;
+    for (Real strike : strikeValues) {
+        for (Real forward : forwardValues) {
+            for (Real stdDev : stdDevValues) {
+                strikes[k] = strike;
+                forwards[k] = forward;
+                stdDevs[k] = stdDev;
+                discounts[k] = 0.95 - 0.001*k;
+                ++k;
+            }
+        }
+    }
+
+    for (Option::Type type : types) {
+        for (Real displacement : displacements) {
+            Array values, derivatives, probabilities;
+            blackFormula(type, strikes, forwards, stdDevs, discounts,
+                         displacement, values, &derivatives, &probabilities);
+            for (Size i=0; i<n; ++i) {
+                Real value = blackFormula(type, strikes[i], forwards[i],
+                                          stdDevs[i], discounts[i],
+                                          displacement);
+                Real derivative = blackFormulaStdDevDerivative(
+                    strikes[i], forwards[i], stdDevs[i], discounts[i],
+                    displacement);
+                Real probability = blackFormulaAssetItmProbability(
+                    type, strikes[i], forwards[i], stdDevs[i], displacement);
+                if (values[i] != value || derivatives[i] != derivative
+                    || probabilities[i] != probability)
+                    BOOST_ERROR("batched Black formula differs from "
+                                "scalar one:"
+                                << "\n    type:         " << type
+                                << "\n    strike:       " << strikes[i]
+                                << "\n    forward:      " << forwards[i]
+                                << "\n    std dev:      " << stdDevs[i]
+                                << "\n    displacement: " << displacement
+                                << std::setprecision(16)
+                                << "\n    value:        " << values[i]
+                                << " vs " << value
+                                << "\n    vega:         " << derivatives[i]
+                                << " vs " << derivative
+                                << "\n    probability:  " << probabilities[i]
+                                << " vs " << probability);
+            }
+
+            // round trip through the implied standard deviation
+            std::vector<Size> used;
+            for (Size i=0; i<n; ++i) {
+                // options with negligible time value cannot be inverted
+                Real intrinsic = std::max(type*(forwards[i]-strikes[i]), 0.0)
+                    * discounts[i];
+                if (strikes[i]+displacement > 0.0
+                    && values[i] - intrinsic > 1.0e-6)
+                    used.push_back(i);
+            }
+            Array s(used.size()), f(used.size()), p(used.size()),
+                d(used.size()), g(used.size(), 0.1);
+            for (Size j=0; j<used.size(); ++j) {
+                s[j] = strikes[used[j]];
+                f[j] = forwards[used[j]];
+                p[j] = values[used[j]];
+                d[j] = discounts[used[j]];
+            }
+            const Real accuracy = 1.0e-10;
+            Array implied = blackFormulaImpliedStdDev(
+                type, s, f, p, d, displacement, g, accuracy);
+            for (Size j=0; j<used.size(); ++j) {
+                Real expected = blackFormulaImpliedStdDev(
+                    type, s[j], f[j], p[j], d[j], displacement, g[j],
+                    accuracy);
+                if (implied[j] != expected)
+                    BOOST_ERROR("batched implied std dev differs from "
+                                "scalar one:"
+                                << std::setprecision(16)
+                                << "\n    batched:  " << implied[j]
+                                << "\n    scalar:   " << expected);
+            }
+        }
+
+        Array values, derivatives, probabilities;
+        bachelierBlackFormula(type, strikes, forwards, stdDevs, discounts,
+                              values, &derivatives, &probabilities);
+        for (Size i=0; i<n; ++i) {
+            Real value = bachelierBlackFormula(type, strikes[i], forwards[i],
+                                               stdDevs[i], discounts[i]);
+            Real derivative = bachelierBlackFormulaStdDevDerivative(
+                strikes[i], forwards[i], stdDevs[i], discounts[i]);
+            Real probability = bachelierBlackFormulaAssetItmProbability(
+                type, strikes[i], forwards[i], stdDevs[i]);
+            if (values[i] != value || derivatives[i] != derivative
+                || probabilities[i] != probability)
+                BOOST_ERROR("batched Bachelier formula differs from "
+                            "scalar one:"
+                            << "\n    type:         " << type
+                            << "\n    strike:       " << strikes[i]
+                            << "\n    forward:      " << forwards[i]
+                            << "\n    std dev:      " << stdDevs[i]
+                            << std::setprecision(16)
+                            << "\n    value:        " << values[i]
+                            << " vs " << value
+                            << "\n    vega:         " << derivatives[i]
+                            << " vs " << derivative
+                            << "\n    probability:  " << probabilities[i]
+                            << " vs " << probability);
+        }
+    }
+}
+
 test_suite* BlackFormulaTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Black formula tests");
 
@@ -457,6 +580,8 @@ test_suite* BlackFormulaTest::suite() {
         &BlackFormulaTest::testBachelierBlackFormulaForwardDerivative));
     suite->add(QUANTLIB_TEST_CASE(
         &BlackFormulaTest::testBachelierBlackFormulaForwardDerivativeWithZeroVolatility));
+    suite->add(QUANTLIB_TEST_CASE(
+        &BlackFormulaTest::testBatchedFormulas));
 
     return suite;
 }
@@ -38,6 +38,7 @@ class BlackFormulaTest {
     static void testBlackFormulaForwardDerivativeWithZeroVolatility();
     static void testBachelierBlackFormulaForwardDerivative();
     static void testBachelierBlackFormulaForwardDerivativeWithZeroVolatility();
+    static void testBatchedFormulas();
 
     static boost::unit_test_framework::test_suite* suite();
 };
@@ -23,6 +23,7 @@
 #include <ql/methods/montecarlo/pathgenerator.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/randomnumbers/inversecumulativersg.hpp>
+#include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
 #include <ql/math/statistics/sequencestatistics.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
@@ -244,10 +245,61 @@ void BrownianBridgeTest::testPathGeneration() {
     }
 }
 
+void BrownianBridgeTest::testSobolGeneratorBlocks() {
+    BOOST_TEST_MESSAGE("Testing block generation of Sobol Brownian variates...");
+
+    const Size factors = 3, steps = 7, dim = factors*steps;
+    // spanning several blocks, the last one partially used
+    const Size paths = 2*SobolBrownianGenerator::pathBlockSize + 13;
+    const unsigned long seed = 42;
+
+    // reference variates, drawn and bridged one path at a time
+    InverseCumulativeRsg<SobolRsg,InverseCumulativeNormal>
+        gsg(SobolRsg(dim, seed, SobolRsg::Jaeckel));
+    std::vector<std::vector<Real> > variates(dim, std::vector<Real>(paths));
+    for (Size j=0; j<paths; ++j) {
+        const std::vector<Real>& sample = gsg.nextSequence().value;
+        for (Size k=0; k<dim; ++k)
+            variates[k][j] = sample[k];
+    }
+    SobolBrownianGenerator reference(factors, steps,
+                                     SobolBrownianGenerator::Diagonal, seed);
+    std::vector<std::vector<Real> > expected = reference.transform(variates);
+
+    SobolBrownianGenerator generator(factors, steps,
+                                     SobolBrownianGenerator::Diagonal, seed);
+    SobolBrownianGenerator blockGenerator(factors, steps,
+                                          SobolBrownianGenerator::Diagonal,
+                                          seed);
+    std::vector<Real> blockVariates, weights;
+    blockGenerator.nextPaths(paths, blockVariates, weights);
+
+    std::vector<Real> output(factors);
+    for (Size j=0; j<paths; ++j) {
+        generator.nextPath();
+        for (Size t=0; t<steps; ++t) {
+            generator.nextStep(output);
+            for (Size i=0; i<factors; ++i) {
+                Real x = expected[i][j*steps+t];
+                Real y = blockVariates[(j*factors+i)*steps+t];
+                if (output[i] != x || y != x)
+                    BOOST_FAIL("failed to reproduce Brownian variates"
+                               << "\n    path:     " << j
+                               << "\n    step:     " << t
+                               << "\n    factor:   " << i
+                               << "\n    expected: " << x
+                               << "\n    by step:  " << output[i]
+                               << "\n    by block: " << y);
+            }
+        }
+    }
+}
+
 test_suite* BrownianBridgeTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Brownian bridge tests");
     suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testVariates));
     suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testPathGeneration));
+    suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testSobolGeneratorBlocks));
     return suite;
 }
 
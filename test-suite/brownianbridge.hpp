@@ -29,6 +29,7 @@ class BrownianBridgeTest {
   public:
     static void testVariates();
     static void testPathGeneration();
+    static void testSobolGeneratorBlocks();
     static boost::unit_test_framework::test_suite* suite();
 };
 
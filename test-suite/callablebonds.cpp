@@ -568,6 +568,91 @@ void CallableBondTest::testCached() {
 
 }
 
+void CallableBondTest::testSharedTree() {
+
+    BOOST_TEST_MESSAGE("Testing callable bonds priced on a shared tree...");
+
+    Globals vars;
+
+    vars.termStructure.linkTo(vars.makeFlatCurve(0.035));
+    ext::shared_ptr<HullWhite> model =
+        ext::make_shared<HullWhite>(vars.termStructure);
+
+    Schedule schedule =
+        MakeSchedule()
+        .from(vars.issueDate())
+        .to(vars.maturityDate())
+        .withCalendar(vars.calendar)
+        .withFrequency(Semiannual)
+        .withConvention(vars.rollingConvention)
+        .withRule(DateGeneration::Backward);
+
+    CallabilitySchedule calls, puts;
+    for (auto& date : vars.evenYears())
+        calls.push_back(ext::make_shared<Callability>(
+            Bond::Price(100.0, Bond::Price::Clean), Callability::Call, date));
+    for (auto& date : vars.oddYears())
+        puts.push_back(ext::make_shared<Callability>(
+            Bond::Price(100.0, Bond::Price::Clean), Callability::Put, date));
+
+    std::vector<ext::shared_ptr<CallableBond> > bonds;
+    for (Rate coupon : {0.02, 0.035, 0.05}) {
+        std::vector<Rate> coupons(1, coupon);
+        bonds.push_back(ext::make_shared<CallableFixedRateBond>(
+            3, 100.0, schedule, coupons, Thirty360(), vars.rollingConvention,
+            100.0, vars.issueDate(), calls));
+        bonds.push_back(ext::make_shared<CallableFixedRateBond>(
+            3, 100.0, schedule, coupons, Thirty360(), vars.rollingConvention,
+            100.0, vars.issueDate(), puts));
+    }
+
+    TimeGrid grid = TreeCallableFixedRateBondEngine::unionTimeGrid(
+        bonds, vars.termStructure->referenceDate(),
+        vars.termStructure->dayCounter(), 200);
+
+    ext::shared_ptr<PricingEngine> sharedEngine =
+        ext::make_shared<TreeCallableFixedRateBondEngine>(model, grid);
+    for (auto& bond : bonds)
+        bond->setPricingEngine(sharedEngine);
+
+    if (model->cachedTree(grid) != model->cachedTree(grid))
+        BOOST_ERROR("tree for the same time grid was not reused");
+
+    const Real tolerance = 1.0e-10;
+
+    for (Size k=0; k<2; ++k) {
+        if (k == 1)
+            vars.termStructure.linkTo(vars.makeFlatCurve(0.045));
+
+        // an independent model on the same grid must give the same prices
+        ext::shared_ptr<HullWhite> refModel =
+            ext::make_shared<HullWhite>(vars.termStructure);
+        ext::shared_ptr<PricingEngine> refEngine =
+            ext::make_shared<TreeCallableFixedRateBondEngine>(refModel, grid);
+
+        // pricing one bond with a spread must not affect the others
+        bonds[0]->OAS(95.0, vars.termStructure, vars.dayCounter,
+                      Continuous, NoFrequency);
+
+        for (Size i=0; i<bonds.size(); ++i) {
+            bonds[i]->recalculate();
+            Real calculated = bonds[i]->cleanPrice();
+            bonds[i]->setPricingEngine(refEngine);
+            Real expected = bonds[i]->cleanPrice();
+            bonds[i]->setPricingEngine(sharedEngine);
+
+            if (std::fabs(calculated - expected) > tolerance)
+                BOOST_ERROR(
+                    "failed to reproduce price on shared tree:\n"
+                    << std::setprecision(12)
+                    << "    bond:       " << i << "\n"
+                    << "    curve:      " << k << "\n"
+                    << "    calculated: " << calculated << "\n"
+                    << "    expected:   " << expected);
+        }
+    }
+}
+
 test_suite* CallableBondTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Convertible-bond tests");
     suite->add(QUANTLIB_TEST_CASE(&CallableBondTest::testConsistency));
@@ -575,6 +660,7 @@ test_suite* CallableBondTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&CallableBondTest::testObservability));
     suite->add(QUANTLIB_TEST_CASE(&CallableBondTest::testDegenerate));
     suite->add(QUANTLIB_TEST_CASE(&CallableBondTest::testCached));
+    suite->add(QUANTLIB_TEST_CASE(&CallableBondTest::testSharedTree));
     return suite;
 }
 
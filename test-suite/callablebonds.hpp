@@ -29,6 +29,7 @@ class CallableBondTest {
     static void testObservability();
     static void testDegenerate();
     static void testCached();
+    static void testSharedTree();
     static boost::unit_test_framework::test_suite* suite();
 };
 
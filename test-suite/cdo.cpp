@@ -27,6 +27,8 @@
 #include <ql/experimental/credit/inhomogeneouspooldef.hpp>
 #include <ql/experimental/credit/homogeneouspooldef.hpp>
 #include <ql/experimental/credit/gaussianlhplossmodel.hpp>
+#include <ql/experimental/credit/binomiallossmodel.hpp>
+#include <ql/experimental/credit/recursivelossmodel.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/credit/flathazardrate.hpp>
 #include <ql/time/calendars/target.hpp>
@@ -365,10 +367,185 @@ void CdoTest::testHW(unsigned dataSet) {
 }
 
 
+void CdoTest::testRecursiveLossModel() {
+    #ifndef QL_PATCH_SOLARIS
+
+    BOOST_TEST_MESSAGE ("Testing recursive loss model against exact "
+                        "homogeneous models...");
+
+    SavedSettings backup;
+
+    Size poolSize = 10;
+    Date asofDate = Date(31, August, 2006);
+    Date horizon = Date(31, August, 2011);
+    Settings::instance().evaluationDate() = asofDate;
+
+    Handle<Quote> hazardRate(ext::shared_ptr<Quote>(new SimpleQuote(0.02)));
+    ext::shared_ptr<DefaultProbabilityTermStructure> ptr (
+               new FlatHazardRate (asofDate,
+                                   hazardRate,
+                                   ActualActual(ActualActual::ISDA)));
+    ext::shared_ptr<Pool> pool (new Pool());
+    vector<string> names;
+    vector<pair<DefaultProbKey,
+           Handle<DefaultProbabilityTermStructure> > > probabilities;
+    probabilities.emplace_back(
+        NorthAmericaCorpDefaultKey(EURCurrency(), SeniorSec, Period(0, Weeks), 10.),
+        Handle<DefaultProbabilityTermStructure>(ptr));
+    for (Size i=0; i<poolSize; ++i) {
+        ostringstream o;
+        o << "issuer-" << i;
+        names.push_back(o.str());
+        pool->add(names.back(), Issuer(probabilities),
+                  NorthAmericaCorpDefaultKey(EURCurrency(), SeniorSec,
+                                             Period(), 1.));
+    }
+    Handle<Quote> hCorrelation(
+                           ext::shared_ptr<Quote>(new SimpleQuote(0.3)));
+
+    // Homogeneous basket: with equal loss given default the binomial
+    //   model is exact and shares the latent model integration, so the
+    //   two have to agree to rounding.
+    {
+        vector<Real> nominals(poolSize, 100.0);
+        ext::shared_ptr<GaussianConstantLossLM> lm(new GaussianConstantLossLM(
+            hCorrelation, std::vector<Real>(poolSize, 0.4),
+            LatentModelIntegrationType::GaussianQuadrature, poolSize,
+            GaussianCopulaPolicy::initTraits()));
+        ext::shared_ptr<Basket> basket(new Basket(asofDate, names, nominals,
+                                                  pool, 0.03, 0.12));
+
+        basket->setLossModel(ext::shared_ptr<DefaultLossModel>(
+            new RecursiveGaussLossModel(lm)));
+        Real recursiveEL = basket->expectedTrancheLoss(horizon);
+        std::map<Real, Probability> recursiveDist =
+            basket->lossDistribution(horizon);
+
+        basket->setLossModel(ext::shared_ptr<DefaultLossModel>(
+            new GaussianBinomialLossModel(lm)));
+        Real binomialEL = basket->expectedTrancheLoss(horizon);
+        std::map<Real, Probability> binomialDist =
+            basket->lossDistribution(horizon);
+
+        basket->setLossModel(ext::shared_ptr<DefaultLossModel>(
+            new HomogGaussPoolLossModel(lm, 100, 5., -5., 50)));
+        Real homogeneousEL = basket->expectedTrancheLoss(horizon);
+
+        // value obtained with the original map based recursion
+        Real expectedEL = 28.7755761508309;
+        if (std::fabs(recursiveEL - expectedEL) > 1.0e-10)
+            BOOST_ERROR("failed to reproduce expected tranche loss"
+                        << std::setprecision(15)
+                        << "\n    calculated: " << recursiveEL
+                        << "\n    expected:   " << expectedEL);
+        if (std::fabs(recursiveEL - binomialEL) > 1.0e-10)
+            BOOST_ERROR("recursive and binomial expected tranche losses "
+                        "differ" << std::setprecision(15)
+                        << "\n    recursive: " << recursiveEL
+                        << "\n    binomial:  " << binomialEL);
+        // the homogeneous pool model buckets and integrates on its own
+        if (std::fabs(recursiveEL/homogeneousEL - 1.0) > 0.02)
+            BOOST_ERROR("recursive and homogeneous pool expected tranche "
+                        "losses differ" << std::setprecision(15)
+                        << "\n    recursive:       " << recursiveEL
+                        << "\n    homogeneous pool: " << homogeneousEL);
+
+        if (recursiveDist.size() != poolSize+1
+            || binomialDist.size() != poolSize+1) {
+            BOOST_ERROR("unexpected number of attainable losses"
+                        << "\n    recursive: " << recursiveDist.size()
+                        << "\n    binomial:  " << binomialDist.size()
+                        << "\n    expected:  " << poolSize+1);
+        } else {
+            std::map<Real, Probability>::const_iterator
+                itR = recursiveDist.begin(), itB = binomialDist.begin();
+            // the binomial model caps the cumulative probability at one,
+            //   which hides quadrature noise in the order of 1e-10
+            for (; itR != recursiveDist.end(); ++itR, ++itB) {
+                // probability of losing more than the given amount
+                Probability overR = 1.0 - itR->second,
+                            overB = 1.0 - itB->second;
+                if (std::fabs(itR->first - itB->first) > 1.0e-8
+                    || std::fabs(overR - overB) > 1.0e-9)
+                    BOOST_ERROR("recursive and binomial loss distributions "
+                                "differ" << std::setprecision(15)
+                                << "\n    recursive: P(L > "
+                                << itR->first << ") = " << overR
+                                << "\n    binomial:  P(L > "
+                                << itB->first << ") = " << overB);
+            }
+        }
+    }
+
+    // Non-homogeneous loss given default: the weights have to be rounded
+    //   to the loss unit, no exact model to compare against; check against
+    //   values obtained with the original map based recursion.
+    {
+        vector<Real> nominals, recoveries;
+        for (Size i=0; i<poolSize; ++i) {
+            nominals.push_back(100.0 + 25.0*(i%3));
+            recoveries.push_back(0.4 - 0.05*(i%4));
+        }
+        ext::shared_ptr<GaussianConstantLossLM> lm(new GaussianConstantLossLM(
+            hCorrelation, recoveries,
+            LatentModelIntegrationType::GaussianQuadrature, poolSize,
+            GaussianCopulaPolicy::initTraits()));
+        ext::shared_ptr<Basket> basket(new Basket(asofDate, names, nominals,
+                                                  pool, 0.03, 0.12));
+
+        Size buckets[] = { 1, 4 };
+        Real expectedEL[] = { 36.7062474899461, 36.3678097859891 };
+        Size expectedSize[] = { 15, 48 };
+        for (Size i=0; i<LENGTH(buckets); ++i) {
+            basket->setLossModel(ext::shared_ptr<DefaultLossModel>(
+                new RecursiveGaussLossModel(lm, buckets[i])));
+            Real calculated = basket->expectedTrancheLoss(horizon);
+            if (std::fabs(calculated - expectedEL[i]) > 1.0e-10)
+                BOOST_ERROR("failed to reproduce expected tranche loss with "
+                            << buckets[i] << " buckets"
+                            << std::setprecision(15)
+                            << "\n    calculated: " << calculated
+                            << "\n    expected:   " << expectedEL[i]);
+            Real percentile = basket->percentile(horizon, 0.95);
+            if (std::fabs(percentile - 110.25) > 1.0e-10)
+                BOOST_ERROR("failed to reproduce 95% percentile with "
+                            << buckets[i] << " buckets"
+                            << std::setprecision(15)
+                            << "\n    calculated: " << percentile
+                            << "\n    expected:   " << 110.25);
+            std::map<Real, Probability> dist =
+                basket->lossDistribution(horizon);
+            if (dist.size() != expectedSize[i])
+                BOOST_ERROR("unexpected number of attainable losses with "
+                            << buckets[i] << " buckets"
+                            << "\n    calculated: " << dist.size()
+                            << "\n    expected:   " << expectedSize[i]);
+        }
+
+        // cumulative probabilities on the quarter loss unit grid
+        Real losses[] = { 90.0, 180.0, 270.0, 360.0 };
+        Probability expectedProb[] = { 0.784077233622684, 0.90317903062661,
+                                       0.957605669604202, 0.98258398576939 };
+        std::map<Real, Probability> dist = basket->lossDistribution(horizon);
+        for (Size i=0; i<LENGTH(losses); ++i) {
+            std::map<Real, Probability>::const_iterator it =
+                dist.lower_bound(losses[i] - 1.0e-8);
+            if (it == dist.end() || std::fabs(it->first - losses[i]) > 1.0e-8
+                || std::fabs(it->second - expectedProb[i]) > 1.0e-10)
+                BOOST_ERROR("failed to reproduce loss distribution at "
+                            << losses[i] << std::setprecision(15)
+                            << "\n    expected: " << expectedProb[i]);
+        }
+    }
+    #endif
+}
+
+
 test_suite* CdoTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("CDO tests");
 
     #ifndef QL_PATCH_SOLARIS
+    suite->add(QUANTLIB_TEST_CASE(&CdoTest::testRecursiveLossModel));
     if (speed == Slow) {
         // unrolled to get different test names
         suite->add(QUANTLIB_TEST_CASE([=](){ CdoTest::testHW(0); }));
@@ -29,6 +29,7 @@
 class CdoTest {
   public:
     static void testHW(unsigned dataSet);
+    static void testRecursiveLossModel();
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
 };
 
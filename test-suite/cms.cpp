@@ -39,6 +39,7 @@
 #include <ql/time/schedule.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/instruments/makecms.hpp>
+#include <ql/math/integrals/kronrodintegral.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -469,10 +470,117 @@ void CmsTest::testParity() {
     }
 }
 
+void CmsTest::testReplicationGrid() {
+
+    BOOST_TEST_MESSAGE("Testing linear TSR pricer on precomputed replication grids...");
+
+    using namespace cms_test;
+
+    CommonVars vars;
+
+    std::vector<Handle<SwaptionVolatilityStructure> > swaptionVols = {
+                           vars.atmVol, vars.SabrVolCube1, vars.SabrVolCube2};
+    // the smiles of the interpolated cube are only piecewise smooth in
+    // the strike, which limits the accuracy of the Gauss-Legendre panels
+    std::vector<Real> tolerances = {1.0e-9, 1.0e-9, 5.0e-8};
+
+    ext::shared_ptr<SwapIndex> swapIndex(new
+        EuriborSwapIsdaFixA(10*Years,
+                            vars.iborIndex->forwardingTermStructure()));
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+    Rate infiniteCap = Null<Real>();
+    Rate infiniteFloor = Null<Real>();
+    std::vector<Rate> strikes = {0.02, 0.035, 0.05, 0.065, 0.08};
+
+    // a strip of coupons sharing fixing dates: a plain coupon, caps and
+    // floors for each strike, both paid at the end of the period and
+    // in arrears
+    std::vector<ext::shared_ptr<CappedFlooredCmsCoupon> > coupons;
+    Date today = vars.termStructure->referenceDate();
+    for (Size i=1; i<=20; ++i) {
+        Date startDate = today + i*Years;
+        Date endDate = startDate + 1*Years;
+        for (Date paymentDate : {endDate, endDate + 3*Months}) {
+            coupons.push_back(ext::make_shared<CappedFlooredCmsCoupon>(
+                paymentDate, 1.0, startDate, endDate,
+                swapIndex->fixingDays(), swapIndex, 1.0, 0.0,
+                infiniteCap, infiniteFloor, Date(), Date(),
+                vars.iborIndex->dayCounter()));
+            for (Rate strike : strikes) {
+                coupons.push_back(ext::make_shared<CappedFlooredCmsCoupon>(
+                    paymentDate, 1.0, startDate, endDate,
+                    swapIndex->fixingDays(), swapIndex, 1.0, 0.0,
+                    strike, infiniteFloor, Date(), Date(),
+                    vars.iborIndex->dayCounter()));
+                coupons.push_back(ext::make_shared<CappedFlooredCmsCoupon>(
+                    paymentDate, 1.0, startDate, endDate,
+                    swapIndex->fixingDays(), swapIndex, 1.0, 0.0,
+                    infiniteCap, strike, Date(), Date(),
+                    vars.iborIndex->dayCounter()));
+            }
+        }
+    }
+
+    for (Size k=0; k<swaptionVols.size(); ++k) {
+        const Handle<SwaptionVolatilityStructure>& swaptionVol =
+            swaptionVols[k];
+        // the reference integrates more tightly than the default
+        // non-adaptive integrator, whose error reaches 1e-7 on the
+        // interpolated cube
+        ext::shared_ptr<CmsCouponPricer> adaptivePricer =
+            ext::make_shared<LinearTsrPricer>(
+                swaptionVol, meanReversion, Handle<YieldTermStructure>(),
+                LinearTsrPricer::Settings(),
+                ext::make_shared<GaussKronrodAdaptive>(1.0e-12, 100000));
+        ext::shared_ptr<CmsCouponPricer> gridPricer =
+            ext::make_shared<LinearTsrPricer>(
+                swaptionVol, meanReversion, Handle<YieldTermStructure>(),
+                LinearTsrPricer::Settings().withReplicationGrid());
+
+        std::vector<Real> adaptivePrices, gridPrices;
+        for (auto& coupon : coupons) {
+            coupon->setPricer(adaptivePricer);
+            adaptivePrices.push_back(coupon->price(vars.termStructure));
+        }
+        for (auto& coupon : coupons) {
+            coupon->setPricer(gridPricer);
+            gridPrices.push_back(coupon->price(vars.termStructure));
+        }
+
+        Real tol = tolerances[k];
+        for (Size i=0; i<coupons.size(); ++i) {
+            Real difference = std::fabs(gridPrices[i] - adaptivePrices[i]);
+            if (difference > tol)
+                BOOST_FAIL("\nCoupon payment date: " << coupons[i]->date() <<
+                           "\nCoupon fixing date:  " << coupons[i]->fixingDate() <<
+                           "\nCap:                 " << coupons[i]->cap() <<
+                           "\nFloor:               " << coupons[i]->floor() <<
+                           "\nadaptive price:      " << adaptivePrices[i] <<
+                           "\ngrid price:          " << gridPrices[i] <<
+                           "\ndifference:          " << difference <<
+                           "\ntolerance:           " << tol);
+        }
+
+        // the grids must follow the market
+        Real before = coupons.front()->price(vars.termStructure);
+        vars.termStructure.linkTo(flatRate(today, 0.04, Actual365Fixed()));
+        Real after = coupons.front()->price(vars.termStructure);
+        coupons.front()->setPricer(adaptivePricer);
+        Real expected = coupons.front()->price(vars.termStructure);
+        if (std::fabs(after - expected) > tol || std::fabs(after - before) < tol)
+            BOOST_FAIL("replication grid not updated after curve change:" <<
+                       "\nprice before change: " << before <<
+                       "\ngrid price:          " << after <<
+                       "\nadaptive price:      " << expected);
+        vars.termStructure.linkTo(flatRate(today, 0.05, Actual365Fixed()));
+    }
+}
+
 test_suite* CmsTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Cms tests");
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testFairRate));
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testCmsSwap));
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testParity));
+    suite->add(QUANTLIB_TEST_CASE(&CmsTest::testReplicationGrid));
     return suite;
 }
@@ -30,6 +30,7 @@ class CmsTest {
     static void testFairRate();
     static void testParity();
     static void testCmsSwap();
+    static void testReplicationGrid();
     static boost::unit_test_framework::test_suite* suite();
 };
 
@@ -745,6 +745,100 @@ void CreditDefaultSwapTest::testAccrualRebateAmounts() {
     }
 }
 
+void CreditDefaultSwapTest::testIsdaBulkPricing() {
+
+    BOOST_TEST_MESSAGE(
+        "Testing bulk ISDA pricing of credit-default swaps...");
+
+    SavedSettings backup;
+
+    Date tradeDate(21, May, 2009);
+    Settings::instance().evaluationDate() = tradeDate;
+
+    std::vector<Date> yieldDates = {tradeDate, Date(21, May, 2010),
+                                    Date(21, May, 2012), Date(21, May, 2014),
+                                    Date(21, May, 2020)};
+    std::vector<DiscountFactor> discounts = {1.0, 0.985, 0.94, 0.88, 0.72};
+    Handle<YieldTermStructure> discountCurve(
+        ext::make_shared<DiscountCurve>(yieldDates, discounts,
+                                        Actual365Fixed()));
+
+    // a few reference names, some on flat and some on piecewise curves
+    std::vector<Date> creditDates = {tradeDate, Date(20, June, 2010),
+                                     Date(20, June, 2012),
+                                     Date(20, June, 2020)};
+    Size names = 6;
+    std::vector<Handle<DefaultProbabilityTermStructure> > probabilities;
+    std::vector<Real> recoveries;
+    for (Size i=0; i<names; ++i) {
+        Real level = 0.005 + 0.01*i;
+        if (i % 2 == 0) {
+            probabilities.emplace_back(ext::make_shared<FlatHazardRate>(
+                tradeDate, level, Actual365Fixed()));
+        } else {
+            std::vector<Rate> hazardRates = {level, level, 1.5*level,
+                                             2.0*level};
+            probabilities.emplace_back(
+                ext::make_shared<InterpolatedHazardRateCurve<BackwardFlat> >(
+                    creditDates, hazardRates, Actual365Fixed()));
+        }
+        recoveries.push_back(i % 3 == 0 ? 0.2 : 0.4);
+    }
+
+    Date termDates[] = {Date(20, June, 2010),
+                        Date(20, June, 2014),
+                        Date(20, June, 2019)};
+    std::vector<ext::shared_ptr<CreditDefaultSwap> > swaps;
+    for (Size i=0; i<names; ++i) {
+        swaps.push_back(
+            MakeCreditDefaultSwap(termDates[i % LENGTH(termDates)],
+                                  i % 2 == 0 ? 0.01 : 0.05)
+                .withNominal(10000000.)
+                .withUpfrontRate(0.001*i)
+                .withSide(i % 3 == 1 ? Protection::Seller
+                                     : Protection::Buyer));
+    }
+
+    std::vector<CreditDefaultSwap::results> results =
+        isdaCdsResults(swaps, probabilities, recoveries, discountCurve);
+
+    BOOST_REQUIRE(results.size() == swaps.size());
+
+    Real tolerance = 1.0e-8;
+    for (Size i=0; i<names; ++i) {
+        ext::shared_ptr<PricingEngine> engine =
+            ext::make_shared<IsdaCdsEngine>(probabilities[i], recoveries[i],
+                                            discountCurve);
+        swaps[i]->setPricingEngine(engine);
+
+        Real values[][2] = {
+            { results[i].value, swaps[i]->NPV() },
+            { results[i].couponLegNPV, swaps[i]->couponLegNPV() },
+            { results[i].defaultLegNPV, swaps[i]->defaultLegNPV() },
+            { results[i].upfrontNPV, swaps[i]->upfrontNPV() },
+            { results[i].accrualRebateNPV, swaps[i]->accrualRebateNPV() },
+            { results[i].fairSpread, swaps[i]->fairSpread() },
+            { results[i].fairUpfront, swaps[i]->fairUpfront() }
+        };
+        const char* labels[] = { "NPV", "coupon-leg NPV", "default-leg NPV",
+                                 "upfront NPV", "accrual-rebate NPV",
+                                 "fair spread", "fair upfront" };
+        for (Size j=0; j<LENGTH(labels); ++j) {
+            if (std::fabs(values[j][0] - values[j][1]) > tolerance)
+                BOOST_ERROR("failed to reproduce " << labels[j]
+                            << " of swap " << i << " in bulk pricing"
+                            << std::setprecision(12)
+                            << "\n    bulk:           " << values[j][0]
+                            << "\n    per instrument: " << values[j][1]);
+        }
+    }
+
+    BOOST_CHECK_THROW(
+        isdaCdsResults(swaps, probabilities,
+                       std::vector<Real>(names - 1, 0.4), discountCurve),
+        Error);
+}
+
 test_suite* CreditDefaultSwapTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Credit-default swap tests");
     suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testCachedValue));
@@ -755,6 +849,7 @@ test_suite* CreditDefaultSwapTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testFairSpread));
     suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testFairUpfront));
     suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testIsdaEngine));
+    suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testIsdaBulkPricing));
     suite->add(QUANTLIB_TEST_CASE(&CreditDefaultSwapTest::testAccrualRebateAmounts));
     return suite;
 }
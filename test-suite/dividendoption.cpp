@@ -33,6 +33,7 @@
 #include <ql/pricingengines/vanilla/analyticdividendeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmmeshercache.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/utilities/dataformatters.hpp>
@@ -1031,6 +1032,127 @@ void DividendOptionTest::testEscrowedDividendModel() {
     }
 }
 
+void DividendOptionTest::testFdMesherCaching() {
+    BOOST_TEST_MESSAGE("Testing finite-difference dividend engine "
+                       "with mesher caching...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(12, October, 2019);
+
+    Settings::instance().evaluationDate() = today;
+
+    const ext::shared_ptr<SimpleQuote> spot =
+        ext::make_shared<SimpleQuote>(100.0);
+    const ext::shared_ptr<SimpleQuote> vol =
+        ext::make_shared<SimpleQuote>(0.3);
+    const Handle<YieldTermStructure> qTS(flatRate(today, 0.02, dc));
+    const Handle<YieldTermStructure> rTS(flatRate(today, 0.05, dc));
+    const Handle<BlackVolTermStructure> volTS(flatVol(today, vol, dc));
+
+    const ext::shared_ptr<BlackScholesMertonProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(spot), qTS, rTS, volTS);
+
+    const Date maturity = today + Period(1, Years);
+    const std::vector<Date> dividendDates = {
+        today + Period(3, Months), today + Period(9, Months)};
+    const std::vector<Real> dividendAmounts = {4.3, 3.8};
+
+    const ext::shared_ptr<Exercise> exercises[] = {
+        ext::make_shared<EuropeanExercise>(maturity),
+        ext::make_shared<AmericanExercise>(today, maturity) };
+    const Option::Type types[] = { Option::Call, Option::Put };
+
+    const FdBlackScholesVanillaEngine::CashDividendModel models[] = {
+        FdBlackScholesVanillaEngine::Spot,
+        FdBlackScholesVanillaEngine::Escrowed };
+
+    for (auto cashDividendModel : models) {
+        const ext::shared_ptr<FdmMesherCache> cache =
+            ext::make_shared<FdmMesherCache>();
+
+        const ext::shared_ptr<PricingEngine> engine =
+            MakeFdBlackScholesVanillaEngine(process)
+                .withTGrid(50).withXGrid(101)
+                .withCashDividendModel(cashDividendModel);
+        const ext::shared_ptr<PricingEngine> cachedEngine =
+            MakeFdBlackScholesVanillaEngine(process)
+                .withTGrid(50).withXGrid(101)
+                .withCashDividendModel(cashDividendModel)
+                .withMesherCache(cache);
+
+        const auto checkNPV = [&](DividendVanillaOption& option) {
+            option.setPricingEngine(engine);
+            const Real expected = option.NPV();
+            option.setPricingEngine(cachedEngine);
+            const Real calculated = option.NPV();
+
+            if (std::fabs(calculated - expected) > 1e-12) {
+                BOOST_ERROR("failed to reproduce npv with mesher caching"
+                            << "\n    cash dividend model: " << cashDividendModel
+                            << "\n    strike:     "
+                            << ext::dynamic_pointer_cast<StrikedTypePayoff>(
+                                   option.payoff())->strike()
+                            << "\n    calculated: " << calculated
+                            << "\n    expected:   " << expected);
+            }
+        };
+
+        // calls and puts, European and American on the same strike
+        // share the equity mesher
+        const Real strikes[] = { 90.0, 110.0 };
+        for (Real strike : strikes)
+            for (const auto& exercise : exercises)
+                for (auto type : types) {
+                    DividendVanillaOption option(
+                        ext::make_shared<PlainVanillaPayoff>(type, strike),
+                        exercise, dividendDates, dividendAmounts);
+                    checkNPV(option);
+                }
+
+        // with escrowed dividends American options add the dividend
+        // dates as stopping times, which changes the mesher
+        const Size expectedMisses =
+            (cashDividendModel == FdBlackScholesVanillaEngine::Spot) ? 2 : 4;
+        const Size expectedHits = 8 - expectedMisses;
+
+        if (cache->misses() != expectedMisses
+            || cache->hits() != expectedHits
+            || cache->size() != expectedMisses) {
+            BOOST_ERROR("unexpected mesher cache statistics"
+                        << "\n    cash dividend model: " << cashDividendModel
+                        << "\n    hits:   " << cache->hits()
+                        << " (" << expectedHits << " expected)"
+                        << "\n    misses: " << cache->misses()
+                        << " (" << expectedMisses << " expected)"
+                        << "\n    size:   " << cache->size()
+                        << " (" << expectedMisses << " expected)");
+        }
+
+        DividendVanillaOption option(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, 100.0),
+            exercises[1], dividendDates, dividendAmounts);
+
+        spot->setValue(105.0);
+        if (cache->size() != 0) {
+            BOOST_ERROR("mesher cache was not flushed after spot change");
+        }
+        checkNPV(option);
+
+        vol->setValue(0.25);
+        if (cache->size() != 0) {
+            BOOST_ERROR("mesher cache was not flushed after "
+                        "volatility change");
+        }
+        checkNPV(option);
+
+        spot->setValue(100.0);
+        vol->setValue(0.3);
+    }
+}
+
 test_suite* DividendOptionTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Dividend European option tests");
     suite->add(QUANTLIB_TEST_CASE(&DividendOptionTest::testEuropeanValues));
@@ -1053,6 +1175,8 @@ test_suite* DividendOptionTest::suite() {
                               &DividendOptionTest::testFdAmericanWithDividendToday));
     suite->add(QUANTLIB_TEST_CASE(
                  &DividendOptionTest::testEscrowedDividendModel));
+    suite->add(QUANTLIB_TEST_CASE(
+                 &DividendOptionTest::testFdMesherCaching));
 
     return suite;
 }
@@ -40,6 +40,7 @@ class DividendOptionTest {
     static void testFdEuropeanWithDividendToday();
     static void testFdAmericanWithDividendToday();
     static void testEscrowedDividendModel();
+    static void testFdMesherCaching();
 
     static boost::unit_test_framework::test_suite* suite();
 };
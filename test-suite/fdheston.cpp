@@ -34,6 +34,7 @@
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/localconstantvol.hpp>
 #include <ql/methods/finitedifferences/meshers/fdmhestonvariancemesher.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmmeshercache.hpp>
 #include <ql/pricingengines/barrier/analyticbarrierengine.hpp>
 #include <ql/pricingengines/vanilla/analytichestonengine.hpp>
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
@@ -979,6 +980,130 @@ void FdHestonTest::testSpuriousOscillations() {
     }
 }
 
+void FdHestonTest::testMesherCaching() {
+    BOOST_TEST_MESSAGE("Testing FDM Heston engine with mesher caching...");
+
+    SavedSettings backup;
+
+    const Date today = Date(18, October, 2021);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dc = Actual365Fixed();
+    const ext::shared_ptr<SimpleQuote> spot = ext::make_shared<SimpleQuote>(100.0);
+    const Handle<Quote> s0(spot);
+    const Handle<YieldTermStructure> rTS(flatRate(today, 0.05, dc));
+    const Handle<YieldTermStructure> qTS(flatRate(today, 0.02, dc));
+
+    const ext::shared_ptr<HestonModel> model = ext::make_shared<HestonModel>(
+        ext::make_shared<HestonProcess>(rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8));
+
+    const ext::shared_ptr<FdmMesherCache> cache =
+        ext::make_shared<FdmMesherCache>();
+
+    const ext::shared_ptr<PricingEngine> cachedEngine =
+        MakeFdHestonVanillaEngine(model)
+            .withTGrid(50).withXGrid(51).withVGrid(21)
+            .withMesherCache(cache);
+    const ext::shared_ptr<PricingEngine> engine =
+        MakeFdHestonVanillaEngine(model)
+            .withTGrid(50).withXGrid(51).withVGrid(21);
+
+    const ext::shared_ptr<Exercise> exercise =
+        ext::make_shared<AmericanExercise>(today + Period(1, Years));
+
+    const Real strikes[] = { 90.0, 100.0, 110.0, 100.0 };
+
+    for (Real strike : strikes) {
+        VanillaOption option(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, strike), exercise);
+
+        option.setPricingEngine(engine);
+        const Real expected = option.NPV();
+
+        option.setPricingEngine(cachedEngine);
+        const Real calculated = option.NPV();
+
+        if (std::fabs(calculated - expected) > 1e-12) {
+            BOOST_ERROR("failed to reproduce npv with mesher caching"
+                        << "\n    strike:     " << strike
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected);
+        }
+    }
+
+    // one variance mesher and three equity meshers, the variance
+    // mesher is reused for every strike after the first one
+    if (cache->misses() != 4 || cache->hits() != 4 || cache->size() != 4) {
+        BOOST_ERROR("unexpected mesher cache statistics"
+                    << "\n    hits:   " << cache->hits() << " (4 expected)"
+                    << "\n    misses: " << cache->misses() << " (4 expected)"
+                    << "\n    size:   " << cache->size() << " (4 expected)");
+    }
+
+    spot->setValue(105.0);
+    if (cache->size() != 0) {
+        BOOST_ERROR("mesher cache was not flushed after spot change");
+    }
+
+    model->setParams(Array({ 0.05, 2.0, 0.5, -0.7, 0.05 }));
+    VanillaOption option(
+        ext::make_shared<PlainVanillaPayoff>(Option::Put, 100.0), exercise);
+    option.setPricingEngine(cachedEngine);
+    const Real calculated = option.NPV();
+
+    if (cache->size() != 2) {
+        BOOST_ERROR("mesher cache was not refilled after model change");
+    }
+
+    option.setPricingEngine(engine);
+    const Real expected = option.NPV();
+    if (std::fabs(calculated - expected) > 1e-12) {
+        BOOST_ERROR("failed to reproduce npv with mesher caching "
+                    "after model change"
+                    << "\n    calculated: " << calculated
+                    << "\n    expected:   " << expected);
+    }
+
+    // the variance mesher depends on the leverage function
+    const ext::shared_ptr<SimpleQuote> leverage =
+        ext::make_shared<SimpleQuote>(1.0);
+    ext::shared_ptr<LocalVolTermStructure> leverageFct =
+        ext::make_shared<LocalConstantVol>(today, Handle<Quote>(leverage), dc);
+
+    const ext::shared_ptr<FdmMesherCache> slvCache =
+        ext::make_shared<FdmMesherCache>();
+    const ext::shared_ptr<PricingEngine> cachedSlvEngine =
+        MakeFdHestonVanillaEngine(model)
+            .withTGrid(50).withXGrid(51).withVGrid(21)
+            .withLeverageFunction(leverageFct)
+            .withMesherCache(slvCache);
+    const ext::shared_ptr<PricingEngine> slvEngine =
+        MakeFdHestonVanillaEngine(model)
+            .withTGrid(50).withXGrid(51).withVGrid(21)
+            .withLeverageFunction(leverageFct);
+
+    option.setPricingEngine(cachedSlvEngine);
+    option.NPV();
+
+    leverage->setValue(0.8);
+    if (slvCache->size() != 0) {
+        BOOST_ERROR("mesher cache was not flushed after "
+                    "leverage function change");
+    }
+
+    option.setPricingEngine(cachedSlvEngine);
+    const Real calculatedSlv = option.NPV();
+    option.setPricingEngine(slvEngine);
+    const Real expectedSlv = option.NPV();
+
+    if (std::fabs(calculatedSlv - expectedSlv) > 1e-12) {
+        BOOST_ERROR("failed to reproduce npv with mesher caching "
+                    "after leverage function change"
+                    << "\n    calculated: " << calculatedSlv
+                    << "\n    expected:   " << expectedSlv);
+    }
+}
+
 test_suite* FdHestonTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Finite Difference Heston tests");
 
@@ -992,6 +1117,7 @@ test_suite* FdHestonTest::suite(SpeedLevel speed) {
         &FdHestonTest::testFdmHestonIntradayPricing));
     suite->add(QUANTLIB_TEST_CASE(&FdHestonTest::testMethodOfLinesAndCN));
     suite->add(QUANTLIB_TEST_CASE(&FdHestonTest::testSpuriousOscillations));
+    suite->add(QUANTLIB_TEST_CASE(&FdHestonTest::testMesherCaching));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(
@@ -36,7 +36,9 @@
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/termstructures/yield/zerocurve.hpp>
+#include <ql/pricingengines/blackformula.hpp>
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
+#include <ql/pricingengines/vanilla/analytichestonengine.hpp>
 #include <ql/pricingengines/vanilla/mchestonhullwhiteengine.hpp>
 #include <ql/methods/finitedifferences/finitedifferencemodel.hpp>
 #include <ql/math/matrixutilities/gmres.hpp>
@@ -50,6 +52,7 @@
 #include <ql/methods/finitedifferences/meshers/fdmblackscholesmesher.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmindicesonboundary.hpp>
 #include <ql/methods/finitedifferences/utilities/fdmmesherintegral.hpp>
 #include <ql/methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
 #include <ql/methods/finitedifferences/operators/numericaldifferentiation.hpp>
@@ -63,6 +66,7 @@
 #include <ql/methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmndimsolver.hpp>
 #include <ql/methods/finitedifferences/solvers/fdm3dimsolver.hpp>
+#include <ql/methods/finitedifferences/solvers/fdmsparsegridsolver.hpp>
 #include <ql/methods/finitedifferences/stepconditions/fdmamericanstepcondition.hpp>
 #include <ql/methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
 #include <ql/methods/finitedifferences/utilities/fdmdividendhandler.hpp>
@@ -143,6 +147,107 @@ namespace {
         V operator()(T t, U u) { return t*u;}
     };
 
+    // sum of independent Black-Scholes operators, one per direction
+    class FdmIndependentBlackScholesOp : public FdmLinearOpComposite {
+      public:
+        FdmIndependentBlackScholesOp(
+            const ext::shared_ptr<FdmMesher>& mesher,
+            const ext::shared_ptr<GeneralizedBlackScholesProcess>& process,
+            Real strike) {
+            for (Size i=0; i < mesher->layout()->dim().size(); ++i)
+                ops_.push_back(ext::make_shared<FdmBlackScholesOp>(
+                    mesher, process, strike, false, -Null<Real>(), i));
+        }
+
+        Size size() const override { return ops_.size(); }
+        void setTime(Time t1, Time t2) override {
+            for (const auto& op: ops_)
+                op->setTime(t1, t2);
+        }
+        Disposable<Array> apply(const Array& r) const override {
+            Array retVal(r.size(), 0.0);
+            for (const auto& op: ops_)
+                retVal += op->apply(r);
+            return retVal;
+        }
+        Disposable<Array> apply_mixed(const Array& r) const override {
+            Array retVal(r.size(), 0.0);
+            return retVal;
+        }
+        Disposable<Array> apply_direction(Size direction,
+                                          const Array& r) const override {
+            return ops_[direction]->apply(r);
+        }
+        Disposable<Array> solve_splitting(Size direction, const Array& r,
+                                          Real s) const override {
+            return ops_[direction]->solve_splitting(direction, r, s);
+        }
+        Disposable<Array> preconditioner(const Array& r,
+                                         Real s) const override {
+            return solve_splitting(0, r, s);
+        }
+
+      private:
+        std::vector<ext::shared_ptr<FdmBlackScholesOp> > ops_;
+    };
+
+    class FdmProductCallInnerValue : public FdmInnerValueCalculator {
+      public:
+        FdmProductCallInnerValue(ext::shared_ptr<FdmMesher> mesher,
+                                 Real strike)
+        : mesher_(std::move(mesher)), strike_(strike) {}
+
+        Real innerValue(const FdmLinearOpIterator& iter, Time) override {
+            Real retVal = 1.0;
+            for (Size i=0; i < mesher_->layout()->dim().size(); ++i)
+                retVal *= std::max(
+                    std::exp(mesher_->location(iter, i)) - strike_, 0.0);
+            return retVal;
+        }
+        // the payoff is separable, hence its cell average is the product
+        // of the cell averages of the call payoffs per direction
+        Real avgInnerValue(const FdmLinearOpIterator& iter, Time) override {
+            const Real k = std::log(strike_);
+
+            Real retVal = 1.0;
+            for (Size i=0; i < mesher_->layout()->dim().size(); ++i) {
+                const Real x = mesher_->location(iter, i);
+                const Real hm = mesher_->dminus(iter, i);
+                const Real hp = mesher_->dplus(iter, i);
+                const Real a = x - 0.5*((hm == Null<Real>()) ? hp : hm);
+                const Real b = x + 0.5*((hp == Null<Real>()) ? hm : hp);
+
+                const Real l = std::max(a, k);
+                retVal *= (b > l)
+                    ? (std::exp(b) - std::exp(l) - strike_*(b - l))/(b - a)
+                    : 0.0;
+            }
+            return retVal;
+        }
+
+      private:
+        const ext::shared_ptr<FdmMesher> mesher_;
+        const Real strike_;
+    };
+
+    // call payoff in log-space smoothed with the M4' kernel. Unlike the
+    // usual cell average the kernel reproduces polynomials up to third
+    // order and hence preserves the convergence order of the
+    // fourth-order compact schemes
+    Real smoothedLogCallPayoff(Real x, Real h, Real strike) {
+        const Size n = 400;
+        Real sum = 0.0;
+        for (Size i=0; i < n; ++i) {
+            const Real z = -2.0 + (i+0.5)*4.0/n;
+            const Real az = std::fabs(z);
+            const Real w = (az < 1.0)
+                ? 1.0 - 2.5*az*az + 1.5*az*az*az
+                : 0.5*(2.0-az)*(2.0-az)*(1.0-az);
+            sum += w*std::max(std::exp(x + z*h) - strike, 0.0);
+        }
+        return sum*4.0/n;
+    }
+
 }
 
 void FdmLinearOpTest::testFdmLinearOpLayout() {
@@ -217,6 +322,108 @@ void FdmLinearOpTest::testFdmLinearOpLayout() {
     }
 }
 
+void FdmLinearOpTest::testFdmLinearOpLayoutLines() {
+
+    BOOST_TEST_MESSAGE("Testing line traversal of the layout...");
+
+    const std::vector<Size> dim = {5, 7, 1, 3};
+    const FdmLinearOpLayout layout(dim);
+
+    for (Size d=0; d < dim.size(); ++d) {
+        std::vector<Size> visited(layout.size(), 0U);
+
+        const Size nLines = layout.numberOfLines(d);
+        if (nLines*dim[d] != layout.size())
+            BOOST_FAIL("wrong number of lines in direction " << d);
+
+        for (Size l=0; l < nLines; ++l) {
+            const Size start = layout.lineStart(d, l);
+            if (l > 0 && start <= layout.lineStart(d, l-1))
+                BOOST_FAIL("line starts are not increasing");
+
+            for (Size k=0; k < dim[d]; ++k) {
+                const Size i = start + k*layout.spacing()[d];
+                ++visited[i];
+
+                std::vector<Size> coordinates(dim.size());
+                Size rest = i;
+                for (Size j=0; j < dim.size(); ++j) {
+                    coordinates[j] = rest % dim[j];
+                    rest /= dim[j];
+                }
+                if (coordinates[d] != k)
+                    BOOST_FAIL("wrong coordinate " << coordinates[d]
+                               << " of node " << k << " in line " << l
+                               << " along direction " << d);
+            }
+        }
+
+        for (Size i=0; i < layout.size(); ++i) {
+            if (visited[i] != 1U)
+                BOOST_FAIL("node " << i << " is visited " << visited[i]
+                           << " times by the lines along direction " << d);
+        }
+    }
+}
+
+void FdmLinearOpTest::testGridSetup() {
+
+    BOOST_TEST_MESSAGE("Testing set-up of operators on a large grid...");
+
+    const std::vector<ext::shared_ptr<Fdm1dMesher> > meshers = {
+        ext::make_shared<Concentrating1dMesher>(
+            -1.0, 1.0, 100, std::pair<Real, Real>(0.0, 0.1)),
+        ext::make_shared<Uniform1dMesher>(0.0, 1.0, 50),
+        ext::make_shared<Uniform1dMesher>(-0.2, 0.2, 40)
+    };
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<FdmMesherComposite>(meshers);
+    const ext::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
+
+    const FdmLinearOpIterator endIter = layout->end();
+    for (Size d=0; d < meshers.size(); ++d) {
+        const FirstDerivativeOp dx(d, mesher);
+        const SecondDerivativeOp dxx(d, mesher);
+        const TripleBandLinearOp op = dxx.mult(mesher->locations(d)).add(dx);
+
+        const Array x = mesher->locations(d);
+        const std::vector<Size> lower = FdmIndicesOnBoundary(
+            layout, d, FdmDirichletBoundary::Lower).getIndices();
+        const std::vector<Size> upper = FdmIndicesOnBoundary(
+            layout, d, FdmDirichletBoundary::Upper).getIndices();
+
+        Size nLower = 0, nUpper = 0;
+        for (FdmLinearOpIterator iter = layout->begin();
+             iter != endIter; ++iter) {
+            if (x[iter.index()] != mesher->location(iter, d))
+                BOOST_FAIL("wrong location in direction " << d);
+
+            const Size co = iter.coordinates()[d];
+            if (co == 0 && lower.at(nLower++) != iter.index())
+                BOOST_FAIL("wrong lower boundary index in direction " << d);
+            if (co == layout->dim()[d]-1 && upper.at(nUpper++) != iter.index())
+                BOOST_FAIL("wrong upper boundary index in direction " << d);
+        }
+        if (nLower != lower.size() || nUpper != upper.size())
+            BOOST_FAIL("wrong number of boundary indices in direction " << d);
+
+        // the operator applied to x^2 gives 2*x + 2*x
+        const Array y = op.apply(x*x);
+        for (FdmLinearOpIterator iter = layout->begin();
+             iter != endIter; ++iter) {
+            const Size co = iter.coordinates()[d];
+            if (co == 0 || co == layout->dim()[d]-1)
+                continue;
+
+            const Real expected = 4.0*x[iter.index()];
+            if (std::fabs(y[iter.index()] - expected) > 1e-8)
+                BOOST_FAIL("failed to apply operator in direction " << d
+                           << "\n    calculated: " << y[iter.index()]
+                           << "\n    expected:   " << expected);
+        }
+    }
+}
+
 void FdmLinearOpTest::testUniformGridMesher() {
 
     BOOST_TEST_MESSAGE("Testing uniform grid mesher...");
@@ -1715,10 +1922,241 @@ void FdmLinearOpTest::testLowVolatilityHighDiscreteDividendBlackScholesMesher()
     }
 }
 
+void FdmLinearOpTest::testFourthOrderCompactBlackScholesOp() {
+
+    BOOST_TEST_MESSAGE("Testing fourth-order compact Black-Scholes operator...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(18, October, 2021);
+    Settings::instance().evaluationDate() = today;
+
+    const Real s0 = 100.0, strike = 100.0;
+    const Time maturity = 1.0;
+
+    const ext::shared_ptr<BlackScholesMertonProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(s0)),
+            Handle<YieldTermStructure>(flatRate(today, 0.02, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.05, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, 0.2, dc)));
+
+    VanillaOption option(
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, strike),
+        ext::make_shared<EuropeanExercise>(today + 365));
+    option.setPricingEngine(
+        ext::make_shared<AnalyticEuropeanEngine>(process));
+    const Real expected = option.NPV();
+
+    const Size tGrid = 400, dampingSteps = 4;
+
+    std::vector<Real> errors;
+    for (Size i=0; i < 2; ++i) {
+        // similar accuracy with four times fewer grid points
+        const bool fourthOrderCompact = (i == 1);
+        const Size xGrid = (fourthOrderCompact) ? 101 : 401;
+
+        const ext::shared_ptr<FdmMesher> mesher =
+            ext::make_shared<FdmMesherComposite>(
+                ext::make_shared<Uniform1dMesher>(
+                    std::log(s0) - 1.5, std::log(s0) + 1.5, xGrid));
+
+        const ext::shared_ptr<FdmLinearOpComposite> op =
+            ext::make_shared<FdmBlackScholesOp>(
+                mesher, process, strike, false, -Null<Real>(), 0,
+                ext::shared_ptr<FdmQuantoHelper>(), fourthOrderCompact);
+
+        const Real h = 3.0/(xGrid-1);
+        Array rhs(mesher->layout()->size());
+        const FdmLinearOpIterator endIter = mesher->layout()->end();
+        for (FdmLinearOpIterator iter = mesher->layout()->begin();
+             iter != endIter; ++iter)
+            rhs[iter.index()] = smoothedLogCallPayoff(
+                mesher->location(iter, 0), h, strike);
+
+        FdmBackwardSolver(op, FdmBoundaryConditionSet(),
+                          ext::shared_ptr<FdmStepConditionComposite>(),
+                          FdmSchemeDesc::CrankNicolson())
+            .rollback(rhs, maturity, 0.0, tGrid, dampingSteps);
+
+        errors.push_back(std::fabs(rhs[(xGrid-1)/2] - expected));
+    }
+
+    const Real tol = 1e-4;
+    if (errors[1] > tol || errors[1] > errors[0]) {
+        BOOST_FAIL("fourth-order compact scheme is not accurate enough"
+                   << "\n    expected:              " << expected
+                   << "\n    error second order:    " << errors[0]
+                   << "\n    error fourth order:    " << errors[1]
+                   << "\n    tolerance:             " << tol);
+    }
+}
+
+void FdmLinearOpTest::testFourthOrderCompactHestonOp() {
+
+    BOOST_TEST_MESSAGE("Testing fourth-order compact Heston operator...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(18, October, 2021);
+    Settings::instance().evaluationDate() = today;
+
+    const Real s0 = 100.0, strike = 100.0, v0 = 0.04;
+    const Time maturity = 1.0;
+
+    const ext::shared_ptr<HestonProcess> process =
+        ext::make_shared<HestonProcess>(
+            Handle<YieldTermStructure>(flatRate(today, 0.05, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.02, dc)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(s0)),
+            v0, 2.5, 0.04, 0.5, -0.7);
+
+    VanillaOption option(
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, strike),
+        ext::make_shared<EuropeanExercise>(today + 365));
+    option.setPricingEngine(
+        ext::make_shared<AnalyticHestonEngine>(
+            ext::make_shared<HestonModel>(process)));
+    const Real expected = option.NPV();
+
+    const Size xGrid = 51, vGrid = 51, tGrid = 100, dampingSteps = 2;
+    const std::vector<Size> dim = {xGrid, vGrid};
+
+    const std::vector<std::pair<Real, Real> > boundaries = {
+        {std::log(s0) - 1.5, std::log(s0) + 1.5}, {0.0, 0.5}};
+
+    const ext::shared_ptr<FdmMesher> mesher =
+        ext::make_shared<UniformGridMesher>(
+            ext::make_shared<FdmLinearOpLayout>(dim), boundaries);
+
+    std::vector<Real> errors;
+    for (Size i=0; i < 2; ++i) {
+        const bool fourthOrderCompact = (i == 1);
+
+        const ext::shared_ptr<FdmLinearOpComposite> op =
+            ext::make_shared<FdmHestonOp>(
+                mesher, process, ext::shared_ptr<FdmQuantoHelper>(),
+                ext::shared_ptr<LocalVolTermStructure>(), 1.0,
+                fourthOrderCompact);
+
+        const Real h = 3.0/(xGrid-1);
+        Array rhs(mesher->layout()->size());
+        const FdmLinearOpIterator endIter = mesher->layout()->end();
+        for (FdmLinearOpIterator iter = mesher->layout()->begin();
+             iter != endIter; ++iter)
+            rhs[iter.index()] = smoothedLogCallPayoff(
+                mesher->location(iter, 0), h, strike);
+
+        FdmBackwardSolver(op, FdmBoundaryConditionSet(),
+                          ext::shared_ptr<FdmStepConditionComposite>(),
+                          FdmSchemeDesc::Hundsdorfer())
+            .rollback(rhs, maturity, 0.0, tGrid, dampingSteps);
+
+        // v0 = 0.04 is the fifth grid point in variance direction
+        errors.push_back(
+            std::fabs(rhs[(xGrid-1)/2 + 4*xGrid] - expected));
+    }
+
+    if (errors[1] > errors[0]) {
+        BOOST_FAIL("fourth-order compact Heston operator is less accurate "
+                   "than the standard operator"
+                   << "\n    expected:              " << expected
+                   << "\n    error second order:    " << errors[0]
+                   << "\n    error fourth order:    " << errors[1]);
+    }
+}
+
+void FdmLinearOpTest::testSparseGridCombinationTechnique() {
+
+    BOOST_TEST_MESSAGE("Testing sparse grid combination technique "
+                       "with a four dimensional PDE...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(18, October, 2021);
+    Settings::instance().evaluationDate() = today;
+
+    const Real s0 = 100.0, strike = 100.0, vol = 0.2;
+    const Time maturity = 1.0;
+    const Size d = 4;
+
+    const ext::shared_ptr<GeneralizedBlackScholesProcess> process =
+        ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(s0)),
+            Handle<YieldTermStructure>(flatRate(today, 0.0, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.0, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, vol, dc)));
+
+    // product of call payoffs on independent, driftless assets
+    const Real callNPV = blackFormula(
+        Option::Call, strike, s0, vol*std::sqrt(maturity));
+    const Real expected = std::pow(callNPV, Real(d));
+
+    const auto solverDescFactory =
+        [=](const std::vector<Size>& dim) -> FdmSolverDesc {
+            std::vector<ext::shared_ptr<Fdm1dMesher> > meshers;
+            for (Size n : dim)
+                meshers.push_back(ext::make_shared<Uniform1dMesher>(
+                    std::log(s0) - 1.0, std::log(s0) + 1.0, n));
+            const ext::shared_ptr<FdmMesher> mesher =
+                ext::make_shared<FdmMesherComposite>(meshers);
+
+            return FdmSolverDesc{
+                mesher, FdmBoundaryConditionSet(),
+                ext::shared_ptr<FdmStepConditionComposite>(),
+                ext::make_shared<FdmProductCallInnerValue>(mesher, strike),
+                maturity, 25, 0};
+        };
+
+    const auto operatorFactory =
+        [=](const ext::shared_ptr<FdmMesher>& mesher)
+            -> ext::shared_ptr<FdmLinearOpComposite> {
+            return ext::make_shared<FdmIndependentBlackScholesOp>(
+                mesher, process, strike);
+        };
+
+    const std::vector<Real> x(d, std::log(s0));
+    const std::vector<Size> minLevels(d, 2);
+
+    const FdmSparseGridSolver solver(
+        minLevels, 4, solverDescFactory, operatorFactory);
+    const Real calculated = solver.interpolateAt(x);
+
+    const Real tol = 0.01;
+    if (std::fabs(calculated - expected) > tol*expected) {
+        BOOST_FAIL("failed to reproduce the price of a four dimensional "
+                   "product option with the sparse grid solver"
+                   << "\n    calculated:  " << calculated
+                   << "\n    expected:    " << expected
+                   << "\n    rel. error:  "
+                   << std::fabs(calculated - expected)/expected
+                   << "\n    tolerance:   " << tol);
+    }
+
+    // the sparse grid requires a small fraction of the grid points
+    // of the equivalent full grid with 2^6+1 points per direction
+    const Size fullGridPoints = Size(std::pow(65.0, Real(d)));
+    if (solver.numberOfGridPoints() > fullGridPoints/10) {
+        BOOST_FAIL("too many grid points for the sparse grid"
+                   << "\n    sparse grid: " << solver.numberOfGridPoints()
+                   << "\n    full grid:   " << fullGridPoints);
+    }
+
+    // the combination technique needs all d levels of component grids
+    BOOST_CHECK_THROW(
+        FdmSparseGridSolver(minLevels, d-2, solverDescFactory, operatorFactory),
+        Error);
+}
+
 test_suite* FdmLinearOpTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("linear operator tests");
 
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmLinearOpLayout));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmLinearOpLayoutLines));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testGridSetup));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testUniformGridMesher));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFirstDerivativesMapApply));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testSecondDerivativesMapApply));
@@ -1736,6 +2174,9 @@ test_suite* FdmLinearOpTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmMesherIntegral));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testHighInterestRateBlackScholesMesher));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testLowVolatilityHighDiscreteDividendBlackScholesMesher));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFourthOrderCompactBlackScholesOp));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFourthOrderCompactHestonOp));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testSparseGridCombinationTechnique));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmHestonHullWhiteOp));
@@ -31,6 +31,8 @@
 class FdmLinearOpTest {
 public:
     static void testFdmLinearOpLayout();
+    static void testFdmLinearOpLayoutLines();
+    static void testGridSetup();
     static void testUniformGridMesher();
     static void testFirstDerivativesMapApply();
     static void testSecondDerivativesMapApply();
@@ -49,6 +51,9 @@ public:
     static void testFdmMesherIntegral();
     static void testHighInterestRateBlackScholesMesher();
     static void testLowVolatilityHighDiscreteDividendBlackScholesMesher();
+    static void testFourthOrderCompactBlackScholesOp();
+    static void testFourthOrderCompactHestonOp();
+    static void testSparseGridCombinationTechnique();
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
 };
@@ -285,9 +285,85 @@ void GsrTest::testGsrModel() {
                     << GsrJamNpv << ")");
 }
 
+void GsrTest::testGridValues() {
+
+    BOOST_TEST_MESSAGE("Testing GSR numeraire and zerobond values on grids...");
+
+    Date refDate = Settings::instance().evaluationDate();
+
+    Handle<YieldTermStructure> yts(ext::shared_ptr<YieldTermStructure>(
+        new FlatForward(0, TARGET(), 0.03, Actual365Fixed())));
+    Handle<YieldTermStructure> yts2(ext::shared_ptr<YieldTermStructure>(
+        new FlatForward(0, TARGET(), 0.035, Actual365Fixed())));
+
+    ext::shared_ptr<SimpleQuote> vol(new SimpleQuote(0.01));
+    std::vector<Date> stepDates;
+    std::vector<Handle<Quote> > vols(1, Handle<Quote>(vol));
+    Handle<Quote> reversion(ext::make_shared<SimpleQuote>(0.02));
+    ext::shared_ptr<Gsr> model(
+        new Gsr(yts, stepDates, vols, reversion, 50.0));
+    ext::shared_ptr<IborIndex> iborIndex(new Euribor6M(yts));
+
+    Array y = model->yGrid(7.0, 32);
+    Real tol = 1.0E-14;
+
+    // the second pass of each round reads the memoized values, the
+    // second round checks that the memo is flushed after a model change
+    for (Size round = 0; round < 2; ++round) {
+        if (round == 1)
+            vol->setValue(0.015);
+        for (Size pass = 0; pass < 2; ++pass) {
+            for (Time t : {0.0, 1.0, 5.0, 10.0}) {
+                for (const auto& curve : {Handle<YieldTermStructure>(), yts2}) {
+                    Array numeraire = model->numeraire(t, y, curve);
+                    for (Size i = 0; i < y.size(); ++i) {
+                        Real expected = model->numeraire(t, y[i], curve);
+                        if (std::fabs(numeraire[i] - expected) > tol * expected)
+                            BOOST_ERROR("numeraire on grid ("
+                                        << numeraire[i]
+                                        << ") differs from pointwise value ("
+                                        << expected << ") at t=" << t
+                                        << ", y=" << y[i] << ", round "
+                                        << round << ", pass " << pass);
+                    }
+                    for (Time T : {t, t + 1.0, t + 10.0}) {
+                        Array zerobond = model->zerobond(T, t, y, curve);
+                        for (Size i = 0; i < y.size(); ++i) {
+                            Real expected = model->zerobond(T, t, y[i], curve);
+                            if (std::fabs(zerobond[i] - expected) >
+                                tol * expected)
+                                BOOST_ERROR("zerobond on grid ("
+                                            << zerobond[i]
+                                            << ") differs from pointwise value ("
+                                            << expected << ") at T=" << T
+                                            << ", t=" << t << ", y=" << y[i]
+                                            << ", round " << round
+                                            << ", pass " << pass);
+                        }
+                    }
+                }
+            }
+            Date referenceDate = refDate + 1 * Years;
+            Date fixing = refDate + 2 * Years;
+            Array forward = model->forwardRate(fixing, referenceDate, y, iborIndex);
+            for (Size i = 0; i < y.size(); ++i) {
+                Real expected =
+                    model->forwardRate(fixing, referenceDate, y[i], iborIndex);
+                if (std::fabs(forward[i] - expected) > tol)
+                    BOOST_ERROR("forward rate on grid ("
+                                << forward[i]
+                                << ") differs from pointwise value ("
+                                << expected << ") at y=" << y[i] << ", round "
+                                << round << ", pass " << pass);
+            }
+        }
+    }
+}
+
 test_suite *GsrTest::suite() {
     auto* suite = BOOST_TEST_SUITE("GSR model tests");
     suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGsrProcess));
     suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGsrModel));
+    suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGridValues));
     return suite;
 }
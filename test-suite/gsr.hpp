@@ -29,6 +29,7 @@ class GsrTest {
   public:
     static void testGsrProcess();
     static void testGsrModel();
+    static void testGridValues();
     static void testNonstandardSwaption();
     static void testDummy();
     static boost::unit_test_framework::test_suite *suite();
@@ -28,6 +28,7 @@
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/methods/finitedifferences/operators/numericaldifferentiation.hpp>
 #include <ql/methods/montecarlo/pathgenerator.hpp>
+#include <ql/models/equity/batesmodel.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/models/equity/hestonmodelhelper.hpp>
 #include <ql/models/equity/piecewisetimedependenthestonmodel.hpp>
@@ -37,6 +38,7 @@
 #include <ql/pricingengines/vanilla/analyticdividendeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/analytichestonengine.hpp>
 #include <ql/pricingengines/vanilla/analyticptdhestonengine.hpp>
+#include <ql/pricingengines/vanilla/batesengine.hpp>
 #include <ql/pricingengines/vanilla/coshestonengine.hpp>
 #include <ql/pricingengines/vanilla/exponentialfittinghestonengine.hpp>
 #include <ql/pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
@@ -3220,6 +3222,177 @@ void HestonModelTest::testAsymptoticControlVariate() {
     }
 }
 
+void HestonModelTest::testChFSliceCaching() {
+    BOOST_TEST_MESSAGE(
+        "Testing Heston calibration with cached characteristic "
+        "function slices...");
+
+    SavedSettings backup;
+
+    const Date settlementDate(5, July, 2002);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    CalibrationMarketData marketData = getDAXCalibrationMarketData();
+
+    const std::vector<ext::shared_ptr<CalibrationHelper> >& options
+        = marketData.options;
+
+    const ext::shared_ptr<HestonModel> models[] = {
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                marketData.riskFreeTS, marketData.dividendYield,
+                marketData.s0, 0.1, 1.0, 0.1, 0.5, -0.5)),
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                marketData.riskFreeTS, marketData.dividendYield,
+                marketData.s0, 0.1, 1.0, 0.1, 0.5, -0.5))
+    };
+
+    const AnalyticHestonEngine::ComplexLogFormula cpxLogs[] = {
+        AnalyticHestonEngine::AndersenPiterbarg,
+        AnalyticHestonEngine::OptimalCV
+    };
+
+    for (auto cpxLog : cpxLogs) {
+        std::vector<Real> sse(2);
+        for (Size i=0; i < 2; ++i) {
+            const ext::shared_ptr<AnalyticHestonEngine> engine =
+                ext::make_shared<AnalyticHestonEngine>(
+                    models[i], cpxLog,
+                    AnalyticHestonEngine::Integration::gaussLaguerre(64));
+
+            if (i == 1)
+                engine->enableSliceCaching(4);
+
+            for (const auto& option : options)
+                ext::dynamic_pointer_cast<BlackCalibrationHelper>(option)
+                    ->setPricingEngine(engine);
+
+            models[i]->setParams(Array({0.1, 1.0, 0.5, -0.5, 0.1}));
+
+            LevenbergMarquardt om(1e-8, 1e-8, 1e-8);
+            models[i]->calibrate(options, om,
+                EndCriteria(400, 40, 1.0e-8, 1.0e-8, 1.0e-8));
+
+            for (const auto& option : options) {
+                const Real diff = option->calibrationError()*100.0;
+                sse[i] += diff*diff;
+            }
+        }
+
+        const Array p0 = models[0]->params();
+        const Array p1 = models[1]->params();
+        for (Size i=0; i < p0.size(); ++i) {
+            if (std::fabs(p0[i] - p1[i]) > 1e-10) {
+                BOOST_ERROR("failed to reproduce calibrated parameters "
+                            "with slice caching"
+                            << "\n  parameter : " << i
+                            << "\n  cached    : " << p1[i]
+                            << "\n  expected  : " << p0[i]);
+            }
+        }
+        if (std::fabs(sse[0] - sse[1]) > 1e-8) {
+            BOOST_ERROR("failed to reproduce calibration error "
+                        "with slice caching"
+                        << "\n  cached    : " << sse[1]
+                        << "\n  expected  : " << sse[0]);
+        }
+    }
+
+    const ext::shared_ptr<AnalyticHestonEngine> gatheralEngine =
+        ext::make_shared<AnalyticHestonEngine>(models[0], 64);
+    BOOST_CHECK_THROW(gatheralEngine->enableSliceCaching(), Error);
+}
+
+
+void HestonModelTest::testChainPricing() {
+    BOOST_TEST_MESSAGE("Testing COS pricing of option chains...");
+
+    SavedSettings backup;
+
+    const Date settlementDate(5, July, 2002);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Date maturityDate = settlementDate + Period(1, Years);
+    const ext::shared_ptr<Exercise> exercise =
+        ext::make_shared<EuropeanExercise>(maturityDate);
+
+    const Handle<YieldTermStructure> riskFreeTS(
+        flatRate(settlementDate, 0.05, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(
+        flatRate(settlementDate, 0.02, dayCounter));
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const Real v0 = 0.04, kappa = 1.5, theta = 0.04, sigma = 0.5, rho = -0.7;
+
+    const ext::shared_ptr<HestonModel> hestonModel =
+        ext::make_shared<HestonModel>(ext::make_shared<HestonProcess>(
+            riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho));
+    const ext::shared_ptr<BatesModel> batesModel =
+        ext::make_shared<BatesModel>(ext::make_shared<BatesProcess>(
+            riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho,
+            0.1, -0.05, 0.1));
+    const ext::shared_ptr<PiecewiseTimeDependentHestonModel> ptdModel =
+        ext::make_shared<PiecewiseTimeDependentHestonModel>(
+            riskFreeTS, dividendTS, s0, v0,
+            ConstantParameter(theta, PositiveConstraint()),
+            ConstantParameter(kappa, PositiveConstraint()),
+            ConstantParameter(sigma, PositiveConstraint()),
+            ConstantParameter(rho, BoundaryConstraint(-1.0, 1.0)),
+            TimeGrid(5.0, 5));
+
+    std::vector<ext::shared_ptr<PlainVanillaPayoff> > payoffs;
+    for (Real strike=50.0; strike <= 200.0; strike+=10.0)
+        payoffs.push_back(ext::make_shared<PlainVanillaPayoff>(
+            (payoffs.size() % 2) ? Option::Put : Option::Call, strike));
+
+    const ext::shared_ptr<PricingEngine> hestonEngine =
+        ext::make_shared<AnalyticHestonEngine>(hestonModel, 1e-12, 10000);
+    const ext::shared_ptr<PricingEngine> batesEngine =
+        ext::make_shared<BatesEngine>(batesModel, 1e-12, 10000);
+
+    const std::vector<Real> cosValues =
+        COSHestonEngine(hestonModel).priceChain(payoffs, maturityDate);
+    const std::vector<Real> analyticValues =
+        AnalyticHestonEngine(hestonModel).priceChain(payoffs, maturityDate);
+    const std::vector<Real> ptdValues =
+        AnalyticPTDHestonEngine(ptdModel).priceChain(payoffs, maturityDate);
+    const std::vector<Real> batesValues =
+        BatesEngine(batesModel).priceChain(payoffs, maturityDate);
+
+    const Real tol = 1e-6;
+    for (Size i=0; i < payoffs.size(); ++i) {
+        VanillaOption option(payoffs[i], exercise);
+
+        option.setPricingEngine(hestonEngine);
+        const Real hestonNPV = option.NPV();
+
+        option.setPricingEngine(batesEngine);
+        const Real batesNPV = option.NPV();
+
+        const Real calculated[] = {
+            cosValues[i], analyticValues[i], ptdValues[i], batesValues[i] };
+        const Real expected[] = { hestonNPV, hestonNPV, hestonNPV, batesNPV };
+        const std::string engines[] = {
+            "COSHestonEngine", "AnalyticHestonEngine",
+            "AnalyticPTDHestonEngine", "BatesEngine" };
+
+        for (Size j=0; j < 4; ++j) {
+            if (std::fabs(calculated[j] - expected[j]) > tol) {
+                BOOST_ERROR("failed to reproduce option price with "
+                            "chain pricing"
+                            << "\n  engine     : " << engines[j]
+                            << "\n  option type: " << payoffs[i]->optionType()
+                            << "\n  strike     : " << payoffs[i]->strike()
+                            << "\n  calculated : " << calculated[j]
+                            << "\n  expected   : " << expected[j]
+                            << "\n  tolerance  : " << tol);
+            }
+        }
+    }
+}
+
 
 test_suite* HestonModelTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Heston model tests");
@@ -3251,6 +3424,8 @@ test_suite* HestonModelTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testHestonEngineIntegration));
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testOptimalControlVariateChoice));
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testAsymptoticControlVariate));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testChFSliceCaching));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testChainPricing));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testDifferentIntegrals));
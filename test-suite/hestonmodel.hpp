@@ -60,6 +60,8 @@ class HestonModelTest {
     static void testHestonEngineIntegration();
     static void testOptimalControlVariateChoice();
     static void testAsymptoticControlVariate();
+    static void testChFSliceCaching();
+    static void testChainPricing();
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
     static boost::unit_test_framework::test_suite* experimental();
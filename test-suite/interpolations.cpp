@@ -42,6 +42,7 @@
 #include <ql/math/optimization/levenbergmarquardt.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/richardsonextrapolation.hpp>
+#include <ql/termstructures/volatility/abcd.hpp>
 #include <ql/tuple.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/utilities/null.hpp>
@@ -2150,6 +2151,90 @@ namespace {
     }
 }
 
+void InterpolationTest::testAnalyticCalibrationDerivatives() {
+
+    BOOST_TEST_MESSAGE("Testing analytic Sabr and Abcd calibration derivatives...");
+
+    const Real h = 1e-6, tolerance = 1e-6;
+
+    // Sabr volatility
+    const Real forward = 0.03, expiry = 2.0;
+    const Real sabrParams[] = { 0.04, 0.6, 0.5, -0.3 };
+    const Real strikes[] = { 0.01, 0.02, 0.03, 0.05, 0.1 };
+    for (Real strike : strikes) {
+        Array gradient(4);
+        Real vol = unsafeSabrVolatilityAndGradient(
+            strike, forward, expiry, sabrParams[0], sabrParams[1],
+            sabrParams[2], sabrParams[3], gradient);
+        Real expected = unsafeSabrVolatility(
+            strike, forward, expiry, sabrParams[0], sabrParams[1],
+            sabrParams[2], sabrParams[3]);
+        if (std::fabs(vol - expected) > 1e-14)
+            BOOST_ERROR("Sabr volatility mismatch at strike " << strike
+                        << ": " << vol << " vs " << expected);
+        for (Size j = 0; j < 4; ++j) {
+            Real p[] = { sabrParams[0], sabrParams[1],
+                         sabrParams[2], sabrParams[3] };
+            p[j] += h;
+            Real up = unsafeSabrVolatility(strike, forward, expiry,
+                                           p[0], p[1], p[2], p[3]);
+            p[j] -= 2.0 * h;
+            Real down = unsafeSabrVolatility(strike, forward, expiry,
+                                             p[0], p[1], p[2], p[3]);
+            Real fd = (up - down) / (2.0 * h);
+            if (std::fabs(gradient[j] - fd) > tolerance)
+                BOOST_ERROR("Sabr gradient mismatch at strike " << strike
+                            << ", parameter " << j << ":"
+                            << "\n    analytic:          " << gradient[j]
+                            << "\n    finite difference: " << fd);
+        }
+    }
+
+    // Sabr parameter transformation
+    Array x(4);
+    x[0] = 0.3; x[1] = 0.8; x[2] = -0.7; x[3] = 0.4;
+    std::vector<bool> fixed(4, false);
+    std::vector<Real> params(4, 0.0);
+    Array dydx = QuantLib::detail::SABRSpecs().directDerivative(
+        x, fixed, params, forward);
+    for (Size j = 0; j < 4; ++j) {
+        Array xp(x), xm(x);
+        xp[j] += h;
+        xm[j] -= h;
+        Real fd = (QuantLib::detail::SABRSpecs().direct(
+                       xp, fixed, params, forward)[j] -
+                   QuantLib::detail::SABRSpecs().direct(
+                       xm, fixed, params, forward)[j]) / (2.0 * h);
+        if (std::fabs(dydx[j] - fd) > tolerance)
+            BOOST_ERROR("Sabr transformation derivative mismatch for "
+                        "parameter " << j << ":"
+                        << "\n    analytic:          " << dydx[j]
+                        << "\n    finite difference: " << fd);
+    }
+
+    // Abcd Black volatility
+    const Real abcdParams[] = { -0.06, 0.17, 0.54, 0.17 };
+    const Time times[] = { 0.1, 1.0, 5.0, 20.0 };
+    for (Time t : times) {
+        Array gradient = abcdBlackVolatilityGradient(
+            t, abcdParams[0], abcdParams[1], abcdParams[2], abcdParams[3]);
+        for (Size j = 0; j < 4; ++j) {
+            Real p[] = { abcdParams[0], abcdParams[1],
+                         abcdParams[2], abcdParams[3] };
+            p[j] += h;
+            Real up = abcdBlackVolatility(t, p[0], p[1], p[2], p[3]);
+            p[j] -= 2.0 * h;
+            Real down = abcdBlackVolatility(t, p[0], p[1], p[2], p[3]);
+            Real fd = (up - down) / (2.0 * h);
+            if (std::fabs(gradient[j] - fd) > tolerance)
+                BOOST_ERROR("Abcd gradient mismatch at time " << t
+                            << ", parameter " << j << ":"
+                            << "\n    analytic:          " << gradient[j]
+                            << "\n    finite difference: " << fd);
+        }
+    }
+}
+
 void InterpolationTest::testLagrangeInterpolation() {
 
     BOOST_TEST_MESSAGE("Testing Lagrange interpolation...");
@@ -2423,6 +2508,7 @@ test_suite* InterpolationTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testRichardsonExtrapolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testSabrSingleCases));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testTransformations));
+    suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testAnalyticCalibrationDerivatives));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testLagrangeInterpolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testLagrangeInterpolationAtSupportPoint));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testLagrangeInterpolationDerivative));
@@ -57,6 +57,7 @@ class InterpolationTest {
     static void testFlochKennedySabrIsSmoothAroundATM();
     static void testLeFlochKennedySabrExample();
     static void testTransformations();
+    static void testAnalyticCalibrationDerivatives();
     static void testLagrangeInterpolation();
     static void testLagrangeInterpolationAtSupportPoint();
     static void testLagrangeInterpolationDerivative();
@@ -259,6 +259,58 @@ void LinearLeastSquaresRegressionTest::test1dLinearRegression() {
     }    
 }
 
+void LinearLeastSquaresRegressionTest::testDesignMatrixRegression() {
+
+    BOOST_TEST_MESSAGE(
+        "Testing regression on a precomputed design matrix...");
+
+    using namespace linear_least_square_regression_test;
+
+    const Size nr = 1000;
+    const Size dims = 3;
+    PseudoRandom::rng_type rng(PseudoRandom::urng_type(1234U));
+
+    std::vector<ext::function<Real(Array)> > v;
+    v.emplace_back(constant<Array, Real>(1.0));
+    for (Size i=0; i < dims; ++i) {
+        v.emplace_back(get_item(i));
+    }
+
+    std::vector<Real> y(nr);
+    std::vector<Array> x(nr, Array(dims));
+    Matrix A(nr, v.size());
+    for (Size i=0; i < nr; ++i) {
+        for (Size j=0; j < dims; ++j) {
+            x[i][j] = rng.next().value;
+        }
+        y[i] = 0.5 + x[i][0] - 2.0*x[i][2] + rng.next().value;
+        for (Size j=0; j < v.size(); ++j) {
+            A[i][j] = v[j](x[i]);
+        }
+    }
+
+    const GeneralLinearLeastSquares expected(x, y, v);
+    const GeneralLinearLeastSquares calculated(A, y);
+
+    for (Size i=0; i < v.size(); ++i) {
+        if (calculated.coefficients()[i] != expected.coefficients()[i]
+            || calculated.standardErrors()[i] != expected.standardErrors()[i])
+            BOOST_ERROR("Failed to reproduce regression on basis functions"
+                << std::setprecision(16)
+                << "\n    coefficient:    " << calculated.coefficients()[i]
+                << "\n    expected:       " << expected.coefficients()[i]
+                << "\n    standard error: " << calculated.standardErrors()[i]
+                << "\n    expected:       " << expected.standardErrors()[i]);
+    }
+    for (Size i=0; i < nr; ++i) {
+        if (calculated.residuals()[i] != expected.residuals()[i])
+            BOOST_ERROR("Failed to reproduce regression residual"
+                << std::setprecision(16)
+                << "\n    residual: " << calculated.residuals()[i]
+                << "\n    expected: " << expected.residuals()[i]);
+    }
+}
+
 
 test_suite* LinearLeastSquaresRegressionTest::suite() {
     auto* suite = BOOST_TEST_SUITE("linear least squares regression tests");
@@ -268,6 +320,8 @@ test_suite* LinearLeastSquaresRegressionTest::suite() {
         &LinearLeastSquaresRegressionTest::testMultiDimRegression));
     suite->add(QUANTLIB_TEST_CASE(
         &LinearLeastSquaresRegressionTest::test1dLinearRegression));
+    suite->add(QUANTLIB_TEST_CASE(
+        &LinearLeastSquaresRegressionTest::testDesignMatrixRegression));
     return suite;
 }
 
@@ -30,6 +30,7 @@ class LinearLeastSquaresRegressionTest {
     static void testRegression();
     static void testMultiDimRegression();
     static void test1dLinearRegression();
+    static void testDesignMatrixRegression();
     static boost::unit_test_framework::test_suite* suite();
 };
 
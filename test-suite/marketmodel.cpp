@@ -78,6 +78,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/pricingengines/blackcalculator.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/math/integrals/segmentintegral.hpp>
+#include <ql/math/matrixutilities/pseudosqrt.hpp>
 #include <ql/math/statistics/convergencestatistics.hpp>
 #include <ql/termstructures/volatility/abcd.hpp>
 #include <ql/termstructures/volatility/abcdcalibration.hpp>
@@ -875,6 +876,82 @@ void MarketModelTest::testOneStepNormalForwardsAndOptionlets() {
     }
 }
 
+void MarketModelTest::testParallelAccountingEngine() {
+
+    BOOST_TEST_MESSAGE("Testing parallel accounting engine "
+                       "in a lognormal forward rate market model...");
+
+    using namespace market_model_test;
+
+    setup();
+
+    std::vector<Rate> forwardStrikes(todaysForwards.size());
+    std::vector<ext::shared_ptr<Payoff> > optionletPayoffs(todaysForwards.size());
+    std::vector<ext::shared_ptr<StrikedTypePayoff> >
+        displacedPayoffs(todaysForwards.size());
+    for (Size i=0; i<todaysForwards.size(); ++i) {
+        forwardStrikes[i] = todaysForwards[i] + 0.01;
+        optionletPayoffs[i] = ext::shared_ptr<Payoff>(new
+            PlainVanillaPayoff(Option::Call, todaysForwards[i]));
+        displacedPayoffs[i] = ext::shared_ptr<StrikedTypePayoff>(new
+            PlainVanillaPayoff(Option::Call, todaysForwards[i]+displacement));
+    }
+
+    OneStepForwards forwards(rateTimes, accruals,
+        paymentTimes, forwardStrikes);
+    OneStepOptionlets optionlets(rateTimes, accruals,
+        paymentTimes, optionletPayoffs);
+
+    MultiProductComposite product;
+    product.add(forwards);
+    product.add(optionlets);
+    product.finalize();
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = makeMeasure(product, MoneyMarket);
+    ext::shared_ptr<MarketModel> marketModel =
+        makeMarketModel(true, evolution, todaysForwards.size(),
+                        ExponentialCorrelationFlatVolatility);
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+
+    // a single evolver must reproduce the sequential engine
+    MTBrownianGeneratorFactory generatorFactory(seed_);
+    ext::shared_ptr<SequenceStatisticsInc> expected = simulate(
+        makeMarketModelEvolver(marketModel, numeraires, generatorFactory, Pc),
+        product);
+
+    std::vector<ext::shared_ptr<MarketModelEvolver> > evolvers(1,
+        makeMarketModelEvolver(marketModel, numeraires, generatorFactory, Pc));
+    ParallelAccountingEngine engine(evolvers, product, initialNumeraireValue);
+    SequenceStatisticsInc stats(product.numberOfProducts());
+    engine.multiplePathValues(stats, paths_);
+
+    std::vector<Real> expectedMeans = expected->mean();
+    std::vector<Real> means = stats.mean();
+    for (Size i=0; i<means.size(); ++i) {
+        if (means[i] != expectedMeans[i])
+            BOOST_ERROR("parallel engine with a single evolver "
+                        "does not reproduce the sequential engine:"
+                        << "\n    product:    " << i
+                        << "\n    parallel:   " << means[i]
+                        << "\n    sequential: " << expectedMeans[i]);
+    }
+
+    // several evolvers on independent streams
+    evolvers.clear();
+    for (Size k=0; k<4; ++k) {
+        MTBrownianGeneratorFactory factory(seed_ + k);
+        evolvers.push_back(
+            makeMarketModelEvolver(marketModel, numeraires, factory, Pc));
+    }
+    ParallelAccountingEngine parallelEngine(evolvers, product,
+                                            initialNumeraireValue);
+    SequenceStatisticsInc parallelStats(product.numberOfProducts());
+    parallelEngine.multiplePathValues(parallelStats, paths_);
+    checkForwardsAndOptionlets(parallelStats, forwardStrikes,
+                               displacedPayoffs, "parallel engine, 4 evolvers");
+}
+
 void MarketModelTest::testInverseFloater() 
 {
 
@@ -4709,6 +4786,73 @@ void MarketModelTest::testCovariance() {
     }
 }
 
+void MarketModelTest::testPseudoRootCaching() {
+    BOOST_TEST_MESSAGE("Testing cached pseudo-roots of flat-vol models...");
+
+    const Size n = 10, factors = 3;
+
+    // two evolution steps per rate period; within a period the same
+    // rates are alive and the step covariances are proportional
+    std::vector<Time> rateTimes, evolTimes;
+    for (Size i=1; i<=n; ++i)
+        rateTimes.push_back(static_cast<Time>(i));
+    for (Size i=1; i<=2*n-2; ++i)
+        evolTimes.push_back(0.5*i);
+    EvolutionDescription evolution(rateTimes, evolTimes);
+
+    std::vector<Volatility> vols(n-1);
+    for (Size i=0; i<n-1; ++i)
+        vols[i] = 0.10 + 0.01*i;
+    std::vector<Rate> rates(n-1, 0.05);
+    std::vector<Spread> displ(n-1, 0.0);
+
+    Matrix c = exponentialCorrelations(rateTimes, 0.5, 0.2, 1.0, 0.0);
+    ext::shared_ptr<PiecewiseConstantCorrelation> corr(
+                          new TimeHomogeneousForwardCorrelation(c, rateTimes));
+
+    FlatVol model(vols, corr, evolution, factors, rates, displ);
+
+    PseudoSqrtCache cache;
+    Real tolerance = 1.0e-12;
+    for (Size k=0; k<evolTimes.size(); ++k) {
+        // each step lies within a rate period, hence rates are either
+        // alive or dead during the whole step
+        Time dt = evolTimes[k] - (k>0 ? evolTimes[k-1] : 0.0);
+        Matrix covariance(n-1, n-1, 0.0);
+        for (Size x=0; x<n-1; ++x)
+            for (Size y=0; y<n-1; ++y)
+                if (std::min(rateTimes[x], rateTimes[y]) >= evolTimes[k])
+                    covariance[x][y] = c[x][y]*vols[x]*vols[y]*dt;
+
+        Matrix cached = cache.rankReducedSqrt(covariance, factors, 1.0,
+                                              SalvagingAlgorithm::None);
+        Matrix expected = rankReducedSqrt(covariance, factors, 1.0,
+                                          SalvagingAlgorithm::None);
+        const Matrix& calculated = model.pseudoRoot(k);
+
+        for (Size x=0; x<n-1; ++x) {
+            for (Size f=0; f<factors; ++f) {
+                if (std::fabs(calculated[x][f] - expected[x][f]) > tolerance
+                    || std::fabs(cached[x][f] - expected[x][f]) > tolerance)
+                    BOOST_FAIL("pseudo-root of step " << k
+                               << " differs at (" << x << "," << f << ")"
+                               << "\n    flat vol:  " << calculated[x][f]
+                               << "\n    cached:    " << cached[x][f]
+                               << "\n    expected:  " << expected[x][f]
+                               << "\n    tolerance: " << tolerance);
+            }
+        }
+    }
+
+    // the second step of each rate period is served from the cache
+    if (cache.hits() != n-1 || cache.size() != n-1)
+        BOOST_FAIL("flat-vol covariances not served from the cache"
+                   << "\n    hits:    " << cache.hits()
+                   << " (expected " << n-1 << ")"
+                   << "\n    entries: " << cache.size()
+                   << " (expected " << n-1 << ")");
+}
+
 // --- Call the desired tests
 test_suite* MarketModelTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Market-model tests");
@@ -4722,6 +4866,7 @@ test_suite* MarketModelTest::suite(SpeedLevel speed) {
 
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testOneStepForwardsAndOptionlets));
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testOneStepNormalForwardsAndOptionlets));
+    suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testParallelAccountingEngine));
 
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testAbcdVolatilityIntegration));
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testAbcdVolatilityCompare));
@@ -4734,6 +4879,7 @@ test_suite* MarketModelTest::suite(SpeedLevel speed) {
 
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testAbcdDegenerateCases));
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testCovariance));
+    suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testPseudoRootCaching));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testGreeks));
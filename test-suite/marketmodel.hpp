@@ -39,6 +39,7 @@ class MarketModelTest {
     static void testAllMultiStepProducts();
     static void testOneStepForwardsAndOptionlets();
     static void testOneStepNormalForwardsAndOptionlets();
+    static void testParallelAccountingEngine();
     static void testCallableSwapNaif();
     static void testCallableSwapLS();
     static void testCallableSwapAnderson(
@@ -55,6 +56,7 @@ class MarketModelTest {
     static void testIsInSubset();
     static void testAbcdDegenerateCases();
     static void testCovariance();
+    static void testPseudoRootCaching();
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
 };
 
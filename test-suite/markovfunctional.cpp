@@ -50,6 +50,7 @@
 #include <ql/pricingengines/capfloor/blackcapfloorengine.hpp>
 #include <ql/models/shortrate/calibrationhelpers/swaptionhelper.hpp>
 #include <ql/models/shortrate/calibrationhelpers/caphelper.hpp>
+#include <ql/quotes/simplequote.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -1679,12 +1680,122 @@ void MarkovFunctionalTest::testBermudanSwaption() {
     Settings::instance().evaluationDate() = savedEvalDate;
 }
 
+void MarkovFunctionalTest::testIncrementalCalibration() {
+
+    BOOST_TEST_MESSAGE("Testing incremental Markov functional calibration...");
+
+    Date savedEvalDate = Settings::instance().evaluationDate();
+    Date referenceDate(14, November, 2012);
+    Settings::instance().evaluationDate() = referenceDate;
+
+    Handle<YieldTermStructure> flatYts_ = flatYts();
+
+    std::vector<Period> optionTenors = {1 * Years, 2 * Years, 3 * Years,
+                                        4 * Years, 5 * Years, 10 * Years};
+    std::vector<Period> swapTenors = {1 * Years, 10 * Years};
+    std::vector<std::vector<ext::shared_ptr<SimpleQuote> > > quotes;
+    std::vector<std::vector<Handle<Quote> > > vols;
+    for (Size i = 0; i < optionTenors.size(); ++i) {
+        quotes.emplace_back();
+        vols.emplace_back();
+        for (Size j = 0; j < swapTenors.size(); ++j) {
+            quotes[i].push_back(
+                ext::make_shared<SimpleQuote>(0.20 - 0.005 * i));
+            vols[i].emplace_back(quotes[i][j]);
+        }
+    }
+    Handle<SwaptionVolatilityStructure> swaptionVts(
+        ext::make_shared<SwaptionVolatilityMatrix>(
+            TARGET(), ModifiedFollowing, optionTenors, swapTenors, vols,
+            Actual365Fixed(), true));
+
+    ext::shared_ptr<SwapIndex> swapIndexBase(
+        new EuriborSwapIsdaFixA(1 * Years));
+
+    std::vector<Date> volStepDates;
+    std::vector<Real> volatilities = {1.0};
+    std::vector<Real> money = {0.1, 0.25, 0.50, 0.75, 1.0, 1.25, 1.50, 2.0, 5.0};
+
+    MarkovFunctional::ModelSettings settings =
+        MarkovFunctional::ModelSettings()
+            .withAdjustments(
+                 MarkovFunctional::ModelSettings::KahaleSmile |
+                 MarkovFunctional::ModelSettings::SmileExponentialExtrapolation)
+            .withSmileMoneynessCheckpoints(money);
+
+    ext::shared_ptr<MarkovFunctional> mf1(new MarkovFunctional(
+        flatYts_, 0.01, volStepDates, volatilities, swaptionVts,
+        expiriesCalBasket1(), tenorsCalBasket1(), swapIndexBase, settings));
+    ext::shared_ptr<MarkovFunctional> mf2(new MarkovFunctional(
+        flatYts_, 0.01, volStepDates, volatilities, swaptionVts,
+        expiriesCalBasket1(), tenorsCalBasket1(), swapIndexBase,
+        MarkovFunctional::ModelSettings(settings)
+            .withIncrementalCalibration()));
+
+    // the incremental recalibration must reproduce the full one
+    Real tol = 1.0E-12;
+    std::vector<Time> times = {0.5, 1.0, 1.5, 3.0, 5.0, 8.0, 10.0};
+    std::vector<Real> states = {-3.0, -1.0, 0.0, 0.5, 2.0};
+
+    // calibration points tabulated in each round: all of them at first,
+    // then only the expiries up to the latest changed one, and all of
+    // them again after a change of the model volatilities. The model adds
+    // calibration points to the given basket to cover the numeraire date.
+    Size nPoints = mf1->modelOutputs().expiries_.size();
+    Size expectedRecalibrated[] = {nPoints, 1, 2, nPoints};
+
+    for (Size round = 0; round < 4; ++round) {
+        if (round == 1)
+            quotes[0][1]->setValue(0.21);
+        if (round == 2)
+            quotes[1][1]->setValue(0.19);
+        if (round == 3) {
+            Array params = mf1->params();
+            params[0] = 1.1;
+            mf1->setParams(params);
+            mf2->setParams(params);
+        }
+
+        mf1->numeraire(0.5, 0.0);
+        mf2->numeraire(0.5, 0.0);
+
+        if (mf1->modelOutputs().recalibratedPoints_ != nPoints)
+            BOOST_ERROR("full calibration tabulated "
+                        << mf1->modelOutputs().recalibratedPoints_
+                        << " calibration points instead of " << nPoints
+                        << " in round " << round);
+        if (mf2->modelOutputs().recalibratedPoints_
+            != expectedRecalibrated[round])
+            BOOST_ERROR("incremental calibration tabulated "
+                        << mf2->modelOutputs().recalibratedPoints_
+                        << " calibration points instead of "
+                        << expectedRecalibrated[round] << " in round "
+                        << round);
+
+        for (Time t : times) {
+            for (Real y : states) {
+                Real expected = mf1->numeraire(t, y);
+                Real calculated = mf2->numeraire(t, y);
+                if (std::fabs(calculated - expected) > tol * expected)
+                    BOOST_ERROR("incremental calibration numeraire ("
+                                << calculated
+                                << ") differs from full calibration ("
+                                << expected << ") at t=" << t << ", y=" << y
+                                << ", round " << round);
+            }
+        }
+    }
+
+    Settings::instance().evaluationDate() = savedEvalDate;
+}
+
 test_suite *MarkovFunctionalTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Markov functional model tests");
 
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testMfStateProcess));
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testKahaleSmileSection));
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testBermudanSwaption));
+    suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testIncrementalCalibration));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testCalibrationTwoInstrumentSets));
@@ -191,6 +191,53 @@ void MatricesTest::testHighamSqrt() {
     }
 }
 
+void MatricesTest::testPseudoSqrtCache() {
+    BOOST_TEST_MESSAGE("Testing memoized rank-reduced square root...");
+
+    using namespace matrices_test;
+
+    const Size n = 10, rank = 3;
+    Matrix covariance(n, n);
+    for (Size i=0; i<n; ++i)
+        for (Size j=0; j<n; ++j)
+            covariance[i][j] = (0.1 + 0.01*i) * (0.1 + 0.01*j)
+                * std::exp(-0.1*std::fabs(Real(i)-Real(j)));
+
+    PseudoSqrtCache cache;
+    Matrix first = cache.rankReducedSqrt(covariance, rank, 1.0,
+                                         SalvagingAlgorithm::None);
+    Matrix expected = rankReducedSqrt(covariance, rank, 1.0,
+                                      SalvagingAlgorithm::None);
+    if (norm(first - expected) != 0.0)
+        BOOST_FAIL("cache miss does not reproduce rankReducedSqrt");
+
+    // a proportional matrix is served from the cache
+    Matrix scaled = 0.37 * covariance;
+    Matrix cached = cache.rankReducedSqrt(scaled, rank, 1.0,
+                                          SalvagingAlgorithm::None);
+    Matrix direct = rankReducedSqrt(scaled, rank, 1.0,
+                                    SalvagingAlgorithm::None);
+    Real error = std::max(norm(cached - direct),
+                          norm(cached*transpose(cached)
+                               - direct*transpose(direct)));
+    Real tolerance = 1.0e-12;
+    if (cache.hits() != 1 || cache.size() != 1)
+        BOOST_FAIL("proportional matrix not served from the cache"
+                   << "\n    hits:    " << cache.hits()
+                   << "\n    entries: " << cache.size());
+    if (error > tolerance)
+        BOOST_FAIL("cached rank-reduced square root failed"
+                   << "\n    error:     " << error
+                   << "\n    tolerance: " << tolerance);
+
+    // a different matrix is not
+    Matrix other = covariance;
+    other[0][0] *= 1.5;
+    cache.rankReducedSqrt(other, rank, 1.0, SalvagingAlgorithm::None);
+    if (cache.hits() != 1 || cache.size() != 2)
+        BOOST_FAIL("non-proportional matrix served from the cache");
+}
+
 void MatricesTest::testSVD() {
 
     BOOST_TEST_MESSAGE("Testing singular value decomposition...");
@@ -718,6 +765,70 @@ void MatricesTest::testInitializers() {
     BOOST_CHECK_EQUAL(m2(1, 2), 6.0);
 }
 
+void MatricesTest::testMatrixProducts() {
+    BOOST_TEST_MESSAGE("Testing cache-blocked matrix kernels...");
+
+    MersenneTwisterUniformRng rng(1234);
+
+    // sizes below, at and above the block size
+    const Size sizes[][3] = {
+        {1, 1, 1}, {3, 130, 67}, {150, 70, 129}, {64, 64, 64}, {2, 0, 5}
+    };
+
+    #if defined(QL_USE_BLAS_LAPACK)
+    const Real tol = 1e-12;
+    #else
+    // same summation order as the plain triple loop
+    const Real tol = 0.0;
+    #endif
+
+    for (const auto& size : sizes) {
+        Matrix a(size[0], size[1]), b(size[1], size[2]);
+        for (Real& x : a)
+            x = rng.nextReal() - 0.5;
+        for (Real& x : b)
+            x = rng.nextReal() - 0.5;
+
+        Matrix expected(size[0], size[2], 0.0);
+        for (Size i=0; i < size[0]; ++i)
+            for (Size k=0; k < size[1]; ++k)
+                for (Size j=0; j < size[2]; ++j)
+                    expected[i][j] += a[i][k]*b[k][j];
+
+        const Matrix calculated = a*b;
+        for (Size i=0; i < size[0]; ++i)
+            for (Size j=0; j < size[2]; ++j)
+                if (std::fabs(calculated[i][j] - expected[i][j]) > tol)
+                    BOOST_FAIL("failed to reproduce matrix product"
+                               << "\n    size      : " << size[0]
+                               << "x" << size[1] << " * " << size[1]
+                               << "x" << size[2]
+                               << "\n    calculated: " << calculated[i][j]
+                               << "\n    expected  : " << expected[i][j]);
+
+        const Matrix t = transpose(b);
+        for (Size i=0; i < b.rows(); ++i)
+            for (Size j=0; j < b.columns(); ++j)
+                if (t[j][i] != b[i][j])
+                    BOOST_FAIL("failed to reproduce transposed matrix");
+
+        Array v(size[0]);
+        for (Real& x : v)
+            x = rng.nextReal() - 0.5;
+
+        const Array vTimesA = v*a;
+        for (Size j=0; j < a.columns(); ++j) {
+            Real e = 0.0;
+            for (Size i=0; i < a.rows(); ++i)
+                e += v[i]*a[i][j];
+            if (vTimesA[j] != e)
+                BOOST_FAIL("failed to reproduce vector matrix product"
+                           << "\n    calculated: " << vTimesA[j]
+                           << "\n    expected  : " << e);
+        }
+    }
+}
+
 test_suite* MatricesTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Matrix tests");
 
@@ -726,6 +837,7 @@ test_suite* MatricesTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testSqrt));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testSVD));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testHighamSqrt));
+    suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testPseudoSqrtCache));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testQRDecomposition));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testQRSolve));
     #if !defined(QL_NO_UBLAS_SUPPORT)
@@ -736,6 +848,7 @@ test_suite* MatricesTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testMoorePenroseInverse));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testIterativeSolvers));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testInitializers));
+    suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testMatrixProducts));
     return suite;
 }
 
@@ -32,6 +32,7 @@ class MatricesTest {
     static void testEigenvectors();
     static void testSqrt();
     static void testHighamSqrt();
+    static void testPseudoSqrtCache();
     static void testSVD();
     static void testQRDecomposition();
     static void testQRSolve();
@@ -42,6 +43,7 @@ class MatricesTest {
     static void testMoorePenroseInverse();
     static void testIterativeSolvers();
     static void testInitializers();
+    static void testMatrixProducts();
     static boost::unit_test_framework::test_suite* suite();
 };
 
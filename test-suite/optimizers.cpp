@@ -33,6 +33,7 @@
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 #include <ql/math/optimization/differentialevolution.hpp>
 #include <ql/math/optimization/goldstein.hpp>
+#include <ql/experimental/math/particleswarmoptimization.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -440,6 +441,11 @@ namespace {
             return fx - p + 1.0;
         }
     };
+
+    class ThreadSafeGriewangk : public Griewangk {
+      public:
+        bool isThreadSafe() const override { return true; }
+    };
 }
 
 void OptimizersTest::testDifferentialEvolution() {
@@ -551,11 +557,74 @@ void OptimizersTest::testDifferentialEvolution() {
     }
 }
 
+void OptimizersTest::testBatchEvaluation() {
+    BOOST_TEST_MESSAGE("Testing batch evaluation in population based optimizers...");
+
+    Griewangk serialCostFunction;
+    ThreadSafeGriewangk parallelCostFunction;
+    CostFunction* costFunctions[] = {
+        &serialCostFunction, &parallelCostFunction
+    };
+
+    BoundaryConstraint constraint(-600.0, 600.0);
+    const Array initialValue(5, 100.0);
+    const EndCriteria endCriteria(100, 20, 1e-12, 1e-10, Null<Real>());
+
+    const Matrix x = {
+        {1.0, 2.0, 3.0, 4.0, 5.0},
+        {-100.0, 50.0, 0.0, 0.0, 10.0},
+        {0.0, 0.0, 0.0, 0.0, 0.0}
+    };
+    for (auto costFunction : costFunctions) {
+        const Array batch = costFunction->batchValue(x);
+        for (Size i=0; i < x.rows(); ++i) {
+            const Real expected
+                = costFunction->value(Array(x.row_begin(i), x.row_end(i)));
+            if (batch[i] != expected)
+                BOOST_ERROR("failed to reproduce cost function value"
+                            << "\n  calculated: " << batch[i]
+                            << "\n  expected:   " << expected);
+        }
+    }
+
+    std::vector<Array> deResults, psoResults;
+    for (auto costFunction : costFunctions) {
+        Problem deProblem(*costFunction, constraint, initialValue);
+        DifferentialEvolution(
+            DifferentialEvolution::Configuration()
+            .withBounds()
+            .withPopulationMembers(100)
+            .withStrategy(DifferentialEvolution::Rand1SelfadaptiveWithRotation)
+            .withAdaptiveCrossover()
+            .withSeed(1234)).minimize(deProblem, endCriteria);
+        deResults.push_back(deProblem.currentValue());
+
+        Problem psoProblem(*costFunction, constraint, initialValue);
+        ParticleSwarmOptimization(
+            50, ext::make_shared<GlobalTopology>(),
+            ext::make_shared<TrivialInertia>(),
+            2.05, 2.05, 1234UL).minimize(psoProblem, endCriteria);
+        psoResults.push_back(psoProblem.currentValue());
+    }
+
+    for (Size i=0; i < initialValue.size(); ++i) {
+        if (deResults[0][i] != deResults[1][i])
+            BOOST_ERROR("differential evolution is not deterministic"
+                        << "\n  serial:   " << deResults[0][i]
+                        << "\n  parallel: " << deResults[1][i]);
+        if (psoResults[0][i] != psoResults[1][i])
+            BOOST_ERROR("particle swarm optimization is not deterministic"
+                        << "\n  serial:   " << psoResults[0][i]
+                        << "\n  parallel: " << psoResults[1][i]);
+    }
+}
+
 test_suite* OptimizersTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Optimizers tests");
 
     suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::test));
     suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::nestedOptimizationTest));
+    suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::testBatchEvaluation));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(
@@ -128,6 +128,7 @@
 #include "dividendoption.hpp"
 #include "europeanoption.hpp"
 #include "fdheston.hpp"
+#include "fdmlinearop.hpp"
 #include "hestonmodel.hpp"
 #include "interpolations.hpp"
 #include "jumpdiffusion.hpp"
@@ -278,6 +279,7 @@ test_suite* init_unit_test_suite(int, char*[]) {
     bm.emplace_back("EuropeanOption::FdEngines", &EuropeanOptionTest::testFdEngines, 148.43);
     bm.emplace_back("FdHestonTest::testFdmHestonAmerican", &FdHestonTest::testFdmHestonAmerican,
                     234.21);
+    bm.emplace_back("FdmLinearOpTest::testGridSetup", &FdmLinearOpTest::testGridSetup, 21.6);
     bm.emplace_back("HestonModel::DAXCalibration", &HestonModelTest::testDAXCalibration, 555.19);
     bm.emplace_back("InterpolationTest::testSabrInterpolation",
                     &InterpolationTest::testSabrInterpolation, 2266.06);
@@ -25,6 +25,7 @@
 #include "utilities.hpp"
 #include <ql/cashflows/iborcoupon.hpp>
 #include <ql/models/shortrate/onefactormodels/hullwhite.hpp>
+#include <ql/models/shortrate/onefactormodels/blackkarasinski.hpp>
 #include <ql/models/shortrate/onefactormodels/extendedcoxingersollross.hpp>
 #include <ql/models/shortrate/calibrationhelpers/swaptionhelper.hpp>
 #include <ql/pricingengines/swaption/jamshidianswaptionengine.hpp>
@@ -453,6 +454,72 @@ void ShortRateModelTest::testExtendedCoxIngersollRossDiscountFactor() {
     }
 }
 
+void ShortRateModelTest::testTreeRollback() {
+    BOOST_TEST_MESSAGE("Testing compiled short-rate tree rollback...");
+
+    SavedSettings backup;
+    const Date today = Settings::instance().evaluationDate();
+
+    const Handle<YieldTermStructure> rTS(
+        flatRate(today, 0.04, Actual365Fixed()));
+
+    std::vector<ext::shared_ptr<OneFactorModel> > models = {
+        ext::make_shared<HullWhite>(rTS, 0.05, 0.01),
+        ext::make_shared<BlackKarasinski>(rTS, 0.05, 0.20)
+    };
+
+    const TimeGrid grid(10.0, 120);
+    const Real tol = 1.0e-14;
+
+    for (Size m=0; m<models.size(); ++m) {
+        ext::shared_ptr<OneFactorModel::ShortRateTree> tree =
+            ext::dynamic_pointer_cast<OneFactorModel::ShortRateTree>(
+                                                   models[m]->tree(grid));
+        BOOST_REQUIRE(tree);
+
+        for (Spread spread : {0.0, 0.01, 0.0}) {
+            tree->setSpread(spread);
+
+            // roll back a zero bond with the compiled stepback and
+            // node by node through the lattice interface
+            Size n = grid.size()-1;
+            Array values(tree->size(n), 1.0), expected(values);
+            for (Integer i=Integer(n)-1; i>=0; --i) {
+                Array newValues(tree->size(i)), newExpected(tree->size(i));
+                tree->stepback(i, values, newValues);
+                for (Size j=0; j<newExpected.size(); ++j) {
+                    Real value = 0.0;
+                    for (Size l=0; l<3; ++l)
+                        value += tree->probability(i,j,l) *
+                                 expected[tree->descendant(i,j,l)];
+                    newExpected[j] = value*tree->discount(i,j);
+                }
+                for (Size j=0; j<newExpected.size(); ++j) {
+                    if (std::fabs(newValues[j]-newExpected[j]) >
+                        tol*newExpected[j])
+                        BOOST_FAIL("compiled rollback failed for model " << m
+                                   << ", spread " << spread
+                                   << ", step " << i << ", node " << j
+                                   << std::scientific
+                                   << "\n  calculated: " << newValues[j]
+                                   << "\n  expected  : " << newExpected[j]);
+                }
+                values.swap(newValues);
+                expected.swap(newExpected);
+            }
+
+            if (spread == 0.0) {
+                DiscountFactor discount = rTS->discount(grid.back());
+                if (std::fabs(values[0]-discount) > 1.0e-6)
+                    BOOST_ERROR("fitted tree does not reproduce the discount "
+                                "factor for model " << m
+                                << "\n  calculated: " << values[0]
+                                << "\n  expected  : " << discount);
+            }
+        }
+    }
+}
+
 test_suite* ShortRateModelTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Short-rate model tests");
 
@@ -462,6 +529,7 @@ test_suite* ShortRateModelTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testFuturesConvexityBias));
     suite->add(QUANTLIB_TEST_CASE(
         &ShortRateModelTest::testExtendedCoxIngersollRossDiscountFactor));
+    suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testTreeRollback));
 
     if (speed == Slow) {
         suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testSwaps));
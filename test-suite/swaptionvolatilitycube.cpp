@@ -23,6 +23,8 @@
 #include "swaptionvolstructuresutilities.hpp"
 #include "utilities.hpp"
 #include <ql/indexes/swap/euriborswap.hpp>
+#include <ql/math/interpolations/bilinearinterpolation.hpp>
+#include <ql/math/interpolations/flatextrapolation2d.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube2.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube1.hpp>
@@ -552,6 +554,150 @@ void SwaptionVolatilityCubeTest::testSabrParameters() {
 
 }
 
+void SwaptionVolatilityCubeTest::testCompiledSabrCube() {
+    BOOST_TEST_MESSAGE("Testing compiled and cached SABR cube queries...");
+
+    using namespace swaption_volatility_cube_test;
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (Size i=0; i<vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size(); i++) {
+        parametersGuess[i] = std::vector<Handle<Quote> >(4);
+        parametersGuess[i][0] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.2)));
+        parametersGuess[i][1] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.5)));
+        parametersGuess[i][2] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.4)));
+        parametersGuess[i][3] =
+            Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+    }
+    std::vector<bool> isParameterFixed(4, false);
+
+    SwaptionVolCube1 volCube(vars.atmVolMatrix,
+                             vars.cube.tenors.options,
+                             vars.cube.tenors.swaps,
+                             vars.cube.strikeSpreads,
+                             vars.cube.volSpreadsHandle,
+                             vars.swapIndexBase,
+                             vars.shortSwapIndexBase,
+                             vars.vegaWeighedSmileFit,
+                             parametersGuess,
+                             isParameterFixed,
+                             false);
+    // the queries below also cover swap lengths past the last tenor,
+    // where the parameters are extrapolated flat
+    volCube.enableExtrapolation();
+    SwaptionVolatilityStructure& volStructure = volCube;
+
+    // reference: interpolate the sparse parameters layer by layer with
+    // flat extrapolated bilinear interpolations
+    Matrix parameters = volCube.sparseSabrParameters();
+    std::vector<Time> swapLengths, optionTimes;
+    for (Size r=0; r<parameters.rows(); ++r) {
+        if (std::find(swapLengths.begin(), swapLengths.end(),
+                      parameters[r][0]) == swapLengths.end())
+            swapLengths.push_back(parameters[r][0]);
+        if (std::find(optionTimes.begin(), optionTimes.end(),
+                      parameters[r][1]) == optionTimes.end())
+            optionTimes.push_back(parameters[r][1]);
+    }
+    const Size nLayers = 5; // alpha, beta, nu, rho, forward
+    std::vector<Matrix> layers(nLayers,
+                               Matrix(swapLengths.size(), optionTimes.size()));
+    for (Size k=0; k<nLayers; ++k)
+        for (Size i=0; i<swapLengths.size(); ++i)
+            for (Size j=0; j<optionTimes.size(); ++j)
+                layers[k][i][j] = parameters[i*optionTimes.size()+j][2+k];
+    std::vector<FlatExtrapolator2D> reference;
+    for (Size k=0; k<nLayers; ++k) {
+        reference.emplace_back(ext::make_shared<BilinearInterpolation>(
+            optionTimes.begin(), optionTimes.end(),
+            swapLengths.begin(), swapLengths.end(), layers[k]));
+        reference.back().enableExtrapolation();
+    }
+
+    std::vector<Time> queryTimes, queryLengths;
+    for (Size i=0; i<40; ++i)
+        queryTimes.push_back(0.1 + 0.37*i);
+    for (Size j=0; j<12; ++j)
+        queryLengths.push_back(0.5 + 2.75*j);
+    std::vector<Rate> strikes;
+    for (Size l=0; l<10; ++l)
+        strikes.push_back(0.01 + 0.006*l);
+
+    Real tolerance = 1.0e-14;
+    for (Time t : queryTimes) {
+        for (Time l : queryLengths) {
+            ext::shared_ptr<SabrSmileSection> section =
+                ext::dynamic_pointer_cast<SabrSmileSection>(
+                    volStructure.smileSection(t, l));
+            Real expected[] = { reference[0](t, l), reference[1](t, l),
+                                reference[2](t, l), reference[3](t, l),
+                                reference[4](t, l) };
+            Real calculated[] = { section->alpha(), section->beta(),
+                                  section->nu(), section->rho(),
+                                  section->atmLevel() };
+            for (Size k=0; k<nLayers; ++k) {
+                if (std::fabs(calculated[k] - expected[k]) > tolerance)
+                    BOOST_ERROR("compiled cube mismatch in layer " << k
+                                << " at option time " << t
+                                << ", swap length " << l
+                                << "\n    calculated: " << calculated[k]
+                                << "\n    expected:   " << expected[k]);
+            }
+
+            std::vector<Volatility> vols = shiftedSabrVolatilities(
+                strikes, section->atmLevel(), t, section->alpha(),
+                section->beta(), section->nu(), section->rho(),
+                section->shift());
+            for (Size m=0; m<strikes.size(); ++m) {
+                if (std::fabs(vols[m] - section->volatility(strikes[m]))
+                    > tolerance)
+                    BOOST_ERROR("vectorized SABR volatility mismatch at "
+                                "strike " << strikes[m]
+                                << "\n    vectorized: " << vols[m]
+                                << "\n    scalar:     "
+                                << section->volatility(strikes[m]));
+            }
+        }
+    }
+
+    // cached sections are shared until the cube is recalculated
+    ext::shared_ptr<SmileSection> s1 = volStructure.smileSection(2.3, 7.1);
+    ext::shared_ptr<SmileSection> s2 = volStructure.smileSection(2.3, 7.1);
+    if (s1 != s2)
+        BOOST_ERROR("smile section not cached");
+    vars.termStructure.linkTo(flatRate(0.04, Actual365Fixed()));
+    ext::shared_ptr<SmileSection> s3 = volStructure.smileSection(2.3, 7.1);
+    if (s3 == s1 || std::fabs(s3->atmLevel() - s1->atmLevel()) < 1.0e-4)
+        BOOST_ERROR("smile section cache not invalidated after "
+                    "term structure change:"
+                    << "\n    forward before: " << s1->atmLevel()
+                    << "\n    forward after:  " << s3->atmLevel());
+
+    // after the recalculation, volatility queries go through the
+    // rebuilt sections
+    for (Time t : queryTimes)
+        for (Time l : queryLengths) {
+            ext::shared_ptr<SmileSection> section =
+                volStructure.smileSection(t, l);
+            for (Rate k : strikes) {
+                Volatility vol = volCube.volatility(t, l, k);
+                if (!(vol > 0.0)
+                    || std::fabs(vol - section->volatility(k)) > tolerance)
+                    BOOST_ERROR("invalid cube volatility at option time "
+                                << t << ", swap length " << l
+                                << ", strike " << k
+                                << "\n    cube:          " << vol
+                                << "\n    smile section: "
+                                << section->volatility(k));
+            }
+        }
+}
+
 
 test_suite* SwaptionVolatilityCubeTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Swaption Volatility Cube tests");
@@ -567,6 +713,7 @@ test_suite* SwaptionVolatilityCubeTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testSpreadedCube));
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testObservability));
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testSabrParameters));
+    suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testCompiledSabrCube));
 
 
     return suite;
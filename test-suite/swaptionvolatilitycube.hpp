@@ -34,6 +34,7 @@ class SwaptionVolatilityCubeTest {
     static void testSpreadedCube();
     static void testObservability();
     static void testSabrParameters();
+    static void testCompiledSabrCube();
 
     static boost::unit_test_framework::test_suite* suite();
 };